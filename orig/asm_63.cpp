@@ -0,0 +1,67 @@
+/******************************************************************************/
+/* asm_63.cpp - host generator of rom_63.h for esp32Forth_63                  */
+/******************************************************************************/
+/* Runs the same macro assembler (asm_63.h) esp32Forth_63 runs at boot, then  */
+/* prints the resulting data[] image in rom_54.h format. With -c it compares  */
+/* the fresh image against rom_63.h byte-for-byte instead.                    */
+/*                                                                            */
+/*   g++ -o asm_63 asm_63.cpp                                                 */
+/*   ./asm_63 > rom_63.h      regenerate after changing asm_63.h              */
+/*   ./asm_63 -c              exit 0 if rom_63.h matches the assembler        */
+/******************************************************************************/
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+# define  popR rack[(unsigned char)R--]
+# define  pushR rack[(unsigned char)++R]
+
+int32_t rack[256] = {0};              /* cells are 32-bit on ESP32 */
+unsigned char R;
+int32_t P, IP, links, len;
+int32_t data[16000] = {};
+uint8_t* cData = (uint8_t *) data;
+
+# define  HEX 16
+struct {                              /* assembler listing is not needed here */
+  template<typename T> void print(T, int=10) {}
+  void println() {}
+  void printf(const char*, ...) {}
+} Serial;
+
+#include "asm_63.h"
+
+#if __has_include("rom_63.h")
+namespace rom {
+#include "rom_63.h"
+}
+# define  ROM_OK 1
+#else
+# define  ROM_OK 0                    /* first run, nothing to compare */
+#endif
+
+int main(int argc, char **argv) {
+  forth_asm();
+  int n = sizeof(data)/sizeof(data[0]);
+  if (argc > 1 && strcmp(argv[1], "-c")==0) {
+#if ROM_OK
+    int err = 0;
+    for (int i=0; i<n; i++) {
+      if ((uint32_t)rom::data[i] == (uint32_t)data[i]) continue;
+      if (err++ < 16) printf("%08X: rom=%08X asm=%08X\n",
+        i<<2, (uint32_t)rom::data[i], (uint32_t)data[i]);
+    }
+    printf("rom_63.h %s (%d cells differ)\n", err ? "MISMATCH" : "OK", err);
+    return err ? 1 : 0;
+#else
+    printf("rom_63.h not found\n");
+    return 1;
+#endif
+  }
+  while (n > 0 && data[n-1]==0) n--;  /* trailing zeros come from {} init */
+  printf("\nlong data[16000] = {\n");
+  for (int i=0; i<n; i++) printf("/* %08X */ 0x%08X,\n", i<<2, (uint32_t)data[i]);
+  printf("0 } ;\n");
+  return 0;
+}
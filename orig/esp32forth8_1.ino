@@ -9,6 +9,7 @@
 #include <stdint.h>     // uintxx_t
 #include <stdlib.h>     // strtol
 #include <string.h>     // strcmp
+#include <math.h>       // sqrt, sin, cos, atan2, pow
 #include <exception>    // try...catch, throw (disable for less capable MCU)
 #include "SPIFFS.h"     // flash memory
 ///
@@ -16,20 +17,53 @@
 /// Note:
 ///    LAMBDA_OK    0 cut 80ms/1M cycles
 ///    RANGE_CHECK  0 cut 100ms/1M cycles
+///    IU32         1 32-bit IU, pmem beyond 64K (in PSRAM), code twice the size
+///    DU64         1 64-bit cells, double cells stay 64-bit
+///    MULTI_VM     1 thread_local VM state, one ForthVM per task
+///    IO_SPLIT     1 web and serial I/O in their own task on IO_CORE
 ///
 #define  LAMBDA_OK      0
 #define  RANGE_CHECK    0
+#define  HWM            1       /** sample stack high watermark in nest() */
+#define  IU32           0
+#define  DU64           0
+#define  MULTI_VM       1
+#if MULTI_VM
+#define  VM_LOCAL       thread_local    /** per-VM state, see ForthVM */
+#else  // MULTI_VM
+#define  VM_LOCAL
+#endif // MULTI_VM
+#define  IO_SPLIT       1
+#define  IO_CORE        0       /** loop() and the VM stay on core 1 */
 ///
 /// logical units (instead of physical) for type check and portability
 ///
+#if IU32
+typedef uint32_t IU;    // instruction pointer unit
+#define  PMEM_SZ        (1024*1024)
+#else  // IU32
 typedef uint16_t IU;    // instruction pointer unit
+#define  PMEM_SZ        (64*1024)
+#endif // IU32
+#if DU64
+typedef int64_t  DU;    // data unit
+typedef uint64_t UDU;   // unsigned data unit
+typedef int64_t  DU2;   // double data unit (no 128-bit type on ESP32)
+typedef double   DF;    // float unit, same size as DU
+#else  // DU64
 typedef int32_t  DU;    // data unit
+typedef uint32_t UDU;   // unsigned data unit
+typedef int64_t  DU2;   // double data unit
+typedef float    DF;    // float unit, same size as DU (ESP32 FPU is single)
+#endif // DU64
+typedef uint32_t U32;   // unsigned 32-bit integer
 typedef uint16_t U16;   // unsigned 16-bit integer
 typedef uint8_t  U8;    // byte, unsigned character
 ///
 /// alignment macros
 ///
-#define ALIGN(sz)       ((sz) + (-(sz) & 0x1))
+#define ALIGN(sz)       ((sz) + (-(sz) & (sizeof(IU)-1)))
+#define ALIGN4(sz)      ((sz) + (-(sz) & 0x3))
 #define ALIGN16(sz)     ((sz) + (-(sz) & 0xf))
 #define INLINE          __attribute__((always_inline))
 ///
@@ -37,29 +71,50 @@ typedef uint8_t  U8;    // byte, unsigned character
 /// Note:
 ///   * using decorator pattern
 ///   * this is similar to vector class but much simplified
-///   * v array is dynamically allocated due to ESP32 has a 96K hard limit
+///   * storage is a policy: Inline keeps v[N] in the object (ss, rs),
+///     Arena carves v from one heap block since ESP32 has a 96K hard limit
+///     on static data, Shared is an Arena block common to all VMs while
+///     each VM keeps its own idx (dict, pmem)
+///   * top(k) indexes from the top (top(1) is the last pushed), at(i) or [i]
+///     from the bottom, so neither does a sign test
+///   * high watermark is sampled by hwm() instead of written on every push
 ///
+void *arena(int sz);                /// bump allocator, see below
 template<class T, int N>
-struct List {
-    T   *v;             /// fixed-size array storage
+struct Inline { T v[N]; };
+template<class T, int N>
+struct Arena  { T *v = (T*)arena(N * sizeof(T)); };
+template<class T, int N>
+struct Shared {
+    static T *blk() { static T *p = (T*)arena(N * sizeof(T)); return p; }
+    T *v = blk();
+};
+
+template<class T, int N, template<class, int> class S=Inline>
+struct List : S<T, N> {
+    using S<T, N>::v;
     int idx = 0;        /// current index of array
+#if HWM
     int max = 0;        /// high watermark for debugging
-
-    List()  { v = new T[N]; }      /// dynamically allocate array memory
-    ~List() { delete[] v;   }      /// free the memory
-    T& operator[](int i) INLINE { return i < 0 ? v[idx + i] : v[i]; }
+    void hwm()           INLINE { if (idx > max) max = idx; }
+#else  // HWM
+    void hwm()           INLINE {}
+#endif // HWM
+    T& top(int k)        INLINE { return v[idx - k]; }
+    T& at(int i)         INLINE { return v[i]; }
+    T& operator[](int i) INLINE { return v[i]; }
 #if RANGE_CHECK
     T pop()     INLINE {
         if (idx>0) return v[--idx];
         throw "ERR: List empty";
     }
     T push(T t) INLINE {
-        if (idx<N) return v[max=idx++] = t;
+        if (idx<N) return v[idx++] = t;
         throw "ERR: List full";
     }
 #else  // RANGE_CHECK
     T pop()     INLINE { return v[--idx]; }
-    T push(T t) INLINE { return v[max=idx++] = t; }
+    T push(T t) INLINE { return v[idx++] = t; }
 #endif // RANGE_CHECK
     void push(T *a, int n) INLINE { for (int i=0; i<n; i++) push(*(a+i)); }
     void merge(List& a)    INLINE { for (int i=0; i<a.idx; i++) push(a[i]);}
@@ -83,9 +138,9 @@ struct Code {
     union {                 /// either a primitive or colon word
         fop xt = 0;         /// lambda pointer (4-byte aligned, thus bit[0,1]=0)
         struct {            /// a colon word
-            U16 def:  1;    /// colon defined word
-            U16 immd: 1;    /// immediate flag
-            U16 len:  14;   /// len of pf (16K max)
+            IU  def:  1;    /// colon defined word
+            IU  immd: 1;    /// immediate flag
+            IU  len:  8*sizeof(IU)-2; /// len of pf (16K max with 16-bit IU)
             IU  pfa;        /// offset to pmem space (16-bit for 64K range)
         };
     };
@@ -103,9 +158,9 @@ struct Code {
     union {                 /// either a primitive or colon word
         fop xt = 0;         /// lambda pointer
         struct {            /// a colon word
-            U16 def:  1;    /// colon defined word
-            U16 immd: 1;    /// immediate flag
-            U16 len:  14;   /// len of pf (16K max)
+            IU  def:  1;    /// colon defined word
+            IU  immd: 1;    /// immediate flag
+            IU  len:  8*sizeof(IU)-2; /// len of pf (16K max with 16-bit IU)
             IU  pfa;        /// offset to pmem space (16-bit for 64K range)
         };
     };
@@ -125,33 +180,55 @@ struct Code {
 ///   2.For ease of byte counting, we use U8 for pmem instead of U16.
 ///   * this makes IP increment by 2 instead of word size. If needed, it can be
 ///   * readjusted.
+///   3.Arena lists come out of one block that is never freed, a VM_LOCAL
+///   * Arena list takes its slice once per VM thread, ARENA_XTRA leaves room
+///   * for a few of those (e.g. ss and rs as Arena, 512 bytes per VM)
 ///
-List<DU,   64>      ss;   /// data stack, can reside in registers for some processors
-List<DU,   64>      rs;   /// return stack
-List<Code, 2048>    dict; /// fixed sized dictionary (RISC vs CISC)
-List<U8,   64*1024> pmem; /// parameter memory i.e. storage for all colon definitions
+#include <atomic>
+#define ARENA_XTRA 4096
+#define ARENA_SZ  (2048*sizeof(Code) + PMEM_SZ + ARENA_XTRA)
+void *arena(int sz) {     /// one zeroed heap block for the Arena lists, never freed
+#if IU32
+    static U8  *blk = (U8*)ps_calloc(1, ARENA_SZ);   /// too big for internal RAM
+#else  // IU32
+    static U8  *blk = (U8*)calloc(1, ARENA_SZ);
+#endif // IU32
+    static std::atomic<int> idx{0};          /// * VM threads allocate concurrently
+    int i = idx.fetch_add(ALIGN16(sz));
+    if (!blk || i + sz > (int)ARENA_SZ) {
+        Serial.print("ERR: arena full, raise ARENA_XTRA\n");
+        abort();                             /// * nothing sane to hand out
+    }
+    return &blk[i];
+}
+VM_LOCAL List<DU, 64>      ss;   /// data stack, can reside in registers for some processors
+VM_LOCAL List<DU, 64>      rs;   /// return stack
+VM_LOCAL List<DF, 32>      fss;  /// float stack
+VM_LOCAL List<Code, 2048, Shared>    dict; /// fixed sized dictionary (RISC vs CISC)
+VM_LOCAL List<U8,   PMEM_SZ, Shared> pmem; /// parameter memory i.e. storage for all colon definitions
 ///
 /// system variables
 ///
-bool compile = false;
-DU   top = -1, base = 10;
-DU   ucase = 1;                 /// case sensitivity control
-IU   WP = 0;                    /// current word pointer
-U8   *PMEM0 = &pmem[0];         /// cached base memory address
-U8   *IP = PMEM0, *IP0 = PMEM0; /// current instruction pointer and cached base pointer
+VM_LOCAL bool compile = false;
+VM_LOCAL DU   top = -1, base = 10;
+VM_LOCAL DU   ucase = 1;        /// case sensitivity control
+VM_LOCAL IU   WP = 0;           /// current word pointer
+U8            *PMEM0 = &pmem[0];/// cached base memory address (shared)
+VM_LOCAL U8   *IP, *IP0;        /// current instruction pointer and cached base pointer
 ///
 /// macros to abstract dict and pmem physical implementation
 /// Note:
 ///   so we can change pmem implementation anytime without affecting opcodes defined below
 ///
 #define STRLEN(s) (ALIGN(strlen(s)+1))      /** calculate string size with alignment     */
-#define XIP       (dict[-1].len)            /** parameter field tail of latest word      */
-#define PFA(w)    ((U8*)&pmem[dict[w].pfa]) /** parameter field pointer of a word        */
-#define PFLEN(w)  (dict[w].len)             /** parameter field length of a word         */
-#define CELL(a)   (*(DU*)&pmem[a])          /** fetch a cell from parameter memory       */
+#define CELLP(p)  ((U8*)ALIGN4((uintptr_t)(p))) /** cell operand following an opcode at p  */
+#define XIP       (dict.top(1).len)         /** parameter field tail of latest word      */
+#define PFA(w)    ((U8*)&pmem[ovl_pfa(w)])  /** parameter field pointer of a word        */
+#define PFLEN(w)  (ovl_len(w))              /** parameter field length of a word         */
+#define CELL(a)   (*(DU*)&pmem[ovl_va(a)])  /** fetch a cell from parameter memory       */
 #define STR(a)    ((char*)&pmem[a])         /** fetch string pointer to parameter memory */
 #define JMPIP     (IP0 + *(IU*)IP)          /** branching target address                 */
-#define SETJMP(a) (*(IU*)(PFA(-1) + (a)))   /** address offset for branching opcodes     */
+#define SETJMP(a) (*(IU*)(PFA(dict.idx-1) + (a))) /** address offset for branching opcodes */
 #define HERE      (pmem.idx)                /** current parameter memory index           */
 #define IPOFF     ((IU)(IP - PMEM0))        /** IP offset relative parameter memory root */
 ///==============================================================================
@@ -161,8 +238,98 @@ U8   *IP = PMEM0, *IP0 = PMEM0; /// current instruction pointer and cached base
 inline int streq(const char *s1, const char *s2) {
     return ucase ? strcasecmp(s1, s2)==0 : strcmp(s1, s2)==0;
 }
+///
+/// shared base image and per-VM overlays
+/// Note:
+///   * dict and pmem are one block each for all VMs, idx (next word, HERE)
+///     is per VM
+///   * freeze turns everything defined so far into the shared base, then
+///     each VM defines into its own overlay of OVL_DICT words, OVL_PMEM bytes
+///   * find() searches the own overlay first, then the base
+///   * copy-on-write: the data of base variables and create'd words is
+///     copied to the front of each overlay on attach, dovar and the pmem
+///     stores and fetches of a VM on an overlay go to its copy, see ovl_va
+///   * to, [to], is on a base word patch it for this overlay only, PFA and
+///     PFLEN look the patch up, so base words calling it see it too
+///   * forget and boot stop at the overlay start, boot also drops the
+///     patches and takes a fresh copy of the base data
+///
+#include <atomic>
+#define OVL_MAX   8
+#define OVL_DICT  128
+#define OVL_PMEM  4096
+#define OVL_PAT   16                        /** to/is patches per overlay */
+struct OvlVar { int lo, len, off; };        /// base data [lo, lo+len) at overlay start + off
+struct OvlPat { IU w, pfa, len; bool cow; };/// base word w runs pfa, len, cow: own body copy
+int          base_didx = 0, base_here = 0;  /// end of the frozen base, 0 before freeze
+OvlVar       *ovl_var = NULL;               /// sorted by lo, see ovl_freeze
+int          ovl_nvar = 0, ovl_vsz = 0;     /// ranges, bytes copied to each overlay
+OvlPat       ovl_pat[OVL_MAX][OVL_PAT];
+U8           ovl_bit[OVL_MAX][2048 / 8];    /// base words with a patch, quick miss
+std::atomic<bool> ovl_used[OVL_MAX];
+VM_LOCAL int ovl_id = -1, ovl_dlo = 0, ovl_plo = 0;
+VM_LOCAL int ovl_base = 0;                  /// pmem below is the base, 0 if not on an overlay
+VM_LOCAL int ovl_np = 0;                    /// patches in ovl_pat[ovl_id]
+
+OvlPat *ovl_patch(IU w) {                   /** this overlay's patch of base word w, or NULL */
+    if (w >= base_didx || !ovl_np || !(ovl_bit[ovl_id][w >> 3] & (1 << (w & 7)))) return NULL;
+    for (int i = 0; i < ovl_np; i++) {
+        if (ovl_pat[ovl_id][i].w == w) return &ovl_pat[ovl_id][i];
+    }
+    return NULL;
+}
+#define OVL_PT(w) ((w) < base_didx && ovl_np ? ovl_patch(w) : NULL)   /** quick miss inline */
+inline IU ovl_pfa(IU w) { OvlPat *p = OVL_PT(w); return p ? p->pfa : dict[w].pfa; }
+inline IU ovl_len(IU w) { OvlPat *p = OVL_PT(w); return p ? p->len : dict[w].len; }
+DU ovl_cow(DU a, DU n) {                    /** base block a..a+n in this overlay's copy, or a */
+    int lo = 0, hi = ovl_nvar;
+    while (lo < hi) {                       /// * last range starting at or below a
+        int m = (lo + hi) / 2;
+        if (ovl_var[m].lo <= a) lo = m + 1;
+        else hi = m;
+    }
+    if (!lo) return a;
+    OvlVar &v = ovl_var[lo - 1];
+    return a + n <= v.lo + v.len ? ovl_plo + v.off + (a - v.lo) : a;   /// * code stays shared
+}
+inline DU ovl_va(DU a, DU n=sizeof(DU)) {   /** pmem address a as this VM sees it */
+    return (UDU)a < (UDU)base_here && ovl_base ? ovl_cow(a, n) : a;
+}
+void ovl_reset() {                          /** empty overlay, fresh base data, no patch */
+    for (int i = 0; i < ovl_nvar; i++) {
+        OvlVar &v = ovl_var[i];
+        memcpy(&pmem[ovl_plo + v.off], &pmem[v.lo], v.len);
+    }
+    memset(ovl_bit[ovl_id], 0, sizeof(ovl_bit[0]));
+    ovl_np   = 0;
+    dict.idx = ovl_dlo;
+    pmem.idx = ovl_plo + ovl_vsz;
+}
+bool ovl_attach() {                         /** claim an overlay for the calling VM */
+    if (!base_didx) return false;
+    for (int i = 0; i < OVL_MAX; i++) {
+        if (ovl_used[i].exchange(true)) continue;
+        ovl_id   = i;
+        ovl_dlo  = base_didx + i * OVL_DICT;
+        ovl_plo  = base_here + i * OVL_PMEM;
+        ovl_base = base_here;
+        ovl_reset();
+        return true;
+    }
+    return false;
+}
+void ovl_release() {
+    if (ovl_id >= 0) ovl_used[ovl_id] = false;
+    ovl_id = -1; ovl_base = 0; ovl_np = 0;
+}
+inline void ovl_room(int n) {               /** before any pmem append */
+    if (ovl_id >= 0 && HERE + n > ovl_plo + OVL_PMEM) throw "ERR: overlay full";
+}
 int find(const char *s) {
-    for (int i = dict.idx - (compile ? 2 : 1); i >= 0; --i) {
+    for (int i = dict.idx - (compile ? 2 : 1); i >= ovl_dlo; --i) {
+        if (streq(s, dict[i].name)) return i;
+    }
+    for (int i = base_didx - 1; i >= 0; --i) {  /// * empty before freeze
         if (streq(s, dict[i].name)) return i;
     }
     return -1;
@@ -170,10 +337,17 @@ int find(const char *s) {
 ///
 /// inline functions to 'comma' object into pmem
 ///
-inline void add_iu(IU i)   { pmem.push((U8*)&i, sizeof(IU)); XIP+=sizeof(IU);  }  /** add an instruction into pmem */
-inline void add_du(DU v)   { pmem.push((U8*)&v, sizeof(DU)), XIP+=sizeof(DU);  }  /** add a cell into pmem         */
+inline void add_iu(IU i)   {                                                      /** add an instruction into pmem */
+    ovl_room(sizeof(IU)); pmem.push((U8*)&i, sizeof(IU)); XIP+=sizeof(IU);
+}
+inline void add_du(DU v)   {                                                      /** add a cell into pmem         */
+    ovl_room(sizeof(DU) + 3);
+    while (HERE & 0x3) { pmem.push(0); XIP++; }                                   /** pad to 4-byte, see CELLP    */
+    pmem.push((U8*)&v, sizeof(DU)); XIP+=sizeof(DU);
+}
+inline void add_df(DF r)   { DU v; memcpy(&v, &r, sizeof(DU)); add_du(v); }      /** add a float into pmem        */
 inline void add_str(const char *s) {                                              /** add a string to pmem         */
-    int sz = STRLEN(s); pmem.push((U8*)s,  sz); XIP += sz;
+    int sz = STRLEN(s); ovl_room(sz); pmem.push((U8*)s,  sz); XIP += sz;
 }
 ///==============================================================================
 ///
@@ -184,12 +358,14 @@ inline void add_str(const char *s) {
 ///   * with an addition link field added.
 ///
 enum {
-    NOP = 0, DOVAR, DOLIT, DOSTR, DOTSTR, BRAN, ZBRAN, DONEXT, DOES, TOR
+    NOP = 0, DOVAR, DOLIT, DOSTR, DOTSTR, BRAN, ZBRAN, DONEXT, DOES, TOR, DOFLIT
 } forth_opcode;
 
 void colon(const char *name) {
     char *nfa = STR(HERE);                  // current pmem pointer
     int sz = STRLEN(name);                  // string length, aligned
+    ovl_room(sz);
+    if (ovl_id >= 0 && dict.idx >= ovl_dlo + OVL_DICT) throw "ERR: overlay full";
     pmem.push((U8*)name,  sz);              // setup raw name field
 #if LAMBDA_OK
     Code c(nfa, [](int){});                 // create a new word on dictionary
@@ -197,11 +373,87 @@ void colon(const char *name) {
     Code c(nfa, NULL);
 #endif // LAMBDA_OK
     c.def = 1;                              // specify a colon word
-    c.len = 0;                              // advance counter (by number of U16)
+    c.len = 0;                              // advance counter (by number of bytes)
     c.pfa = HERE;                           // capture code field index
     dict.push(c);                           // deep copy Code struct into dictionary
 };
 ///
+/// freeze and copy-on-write of base words, see ovl_attach
+///
+bool ovl_freeze() {                         /** by the VM that built the base */
+    if (base_didx) return false;
+    if (ALIGN16(HERE) + OVL_MAX * OVL_PMEM > PMEM_SZ ||
+        dict.idx + OVL_MAX * OVL_DICT > 2048) {   /// * every overlay must fit
+        Serial.print("ERR: no room for the overlays, lower OVL_MAX or the base\n");
+        return false;
+    }
+    OvlVar *v = (OvlVar*)malloc(dict.idx * sizeof(OvlVar));
+    int n = 0, sz = 0;
+    for (int w = 0; w < dict.idx; w++) {    /// * data of every DOVAR word
+        if (!dict[w].def || !dict[w].len || *(IU*)PFA(w) != DOVAR) continue;
+        int lo = (int)(CELLP(PFA(w) + sizeof(IU)) - PMEM0);
+        int hi = dict[w].pfa + dict[w].len;
+        if (hi <= lo) continue;
+        int i = n++;
+        for (; i > 0 && v[i-1].lo > lo; i--) v[i] = v[i-1];   /// * by lo, is may reorder
+        v[i] = { lo, hi - lo, 0 };
+    }
+    for (int i = 0; i < n; i++) { v[i].off = sz; sz += ALIGN4(v[i].len); }
+    if (sz > OVL_PMEM / 2) {                /// * leave room to define into
+        Serial.print("ERR: base data too big for an overlay, raise OVL_PMEM\n");
+        free(v);
+        return false;
+    }
+    ovl_var = v; ovl_nvar = n; ovl_vsz = sz;
+    base_didx = dict.idx;
+    base_here = ALIGN16(HERE);
+    return ovl_attach();
+}
+OvlPat *ovl_own(IU w) {                     /** patch of base word w, made on first use */
+    if (ovl_id < 0 || w >= base_didx) return NULL;
+    OvlPat *p = ovl_patch(w);
+    if (p) return p;
+    if (ovl_np >= OVL_PAT) throw "ERR: overlay full";
+    p = &ovl_pat[ovl_id][ovl_np];
+    *p = { w, dict[w].pfa, (IU)dict[w].len, false };
+    ovl_bit[ovl_id][w >> 3] |= 1 << (w & 7);
+    ovl_np++;
+    return p;
+}
+void ovl_body(IU w) {                       /** own copy of base word w's body, for to */
+    OvlPat *p = dict[w].def ? ovl_own(w) : NULL;
+    if (!p || p->cow) return;
+    ovl_room(p->len + 3);
+    while ((HERE & 0x3) != (p->pfa & 0x3)) pmem.push(0);   /// * same CELLP padding
+    IU pfa = HERE;
+    pmem.push(&pmem[p->pfa], p->len);
+    p->pfa = pfa; p->cow = true;
+}
+///
+/// colon word transaction
+/// Note:
+///   * ':' opens it, ';' commits it
+///   * a compile error rolls dict, pmem and the control-flow stack (ss) back
+///   * so a broken definition neither leaks pmem nor shadows the old word
+///
+VM_LOCAL struct {
+    bool open = false;
+    int  didx, here, sidx;                  /// dict.idx, HERE, ss.idx at ':'
+    DU   top;                               /// top of stack at ':'
+} txn;
+void txn_begin() {
+    txn.open = true;
+    txn.didx = dict.idx; txn.here = HERE;
+    txn.sidx = ss.idx;   txn.top  = top;
+}
+void txn_commit() { txn.open = false; }
+void txn_abort() {
+    if (!txn.open) return;
+    dict.clear(txn.didx); pmem.clear(txn.here);
+    ss.clear(txn.sidx);   top = txn.top;
+    txn.open = false;
+}
+///
 /// Forth inner interpreter (handles a colon word)
 /// Note:
 ///   use local stack, 1070 => 1058, but used 64 bytes per call
@@ -209,21 +461,120 @@ void colon(const char *name) {
 #define CALL(w)                                     \
     if (dict[w].def) nest(w);                       \
     else (*(fop)(((uintptr_t)dict[w].xt)&~0x3))()
+extern std::atomic<int> sched_n;            /// periodic words, see sched_poll
+void sched_poll();
+extern volatile bool ev_flag;               /// interrupt events, see ev_drain
+void ev_drain();
+extern VM_LOCAL bool par_worker;            /// par-for worker, see par_for
+///
+/// instruction budget
+/// Note:
+///   * nest() takes one token off budget per dispatch, returns and backward
+///     branches (again, repeat, until, next) call yield() only once the
+///     budget is used up, so a tight loop of primitives still lets the
+///     watchdog and other FreeRTOS tasks run
+///   * slice is per VM, its tasks share it
+///
+#define SLICE     1000                      /** default tokens between yield() */
+VM_LOCAL int slice  = SLICE;
+VM_LOCAL int budget = SLICE;                /// tokens left in this slice
+#define BUDGET()  { if (budget <= 0) vm_yield(); }
+void vm_yield() { budget = slice; yield(); }
 void nest(IU c) {
+    ss.hwm(); rs.hwm();                     /// * sample high watermarks
     rs.push(IP - PMEM0); rs.push(WP);       /// * setup call frame
     IP0 = IP = PFA(WP=c);                   // CC: this takes 30ms/1K, need work
     try {                                   // CC: is dict[c] kept in cache?
         U8 *ipx = IP + PFLEN(c);            // CC: this saved 350ms/1M
         while (IP < ipx) {                  /// * recursively call all children
-            IU c1 = *IP; IP += sizeof(IU);  // CC: cost of (ipx, c1) on statck?
+            IU c1 = *(IU*)IP; IP += sizeof(IU); // CC: cost of (ipx, c1) on statck?
+            budget--;
             CALL(c1);                       ///> execute child word
         }                                   ///> can do IP++ if pmem unit is 16-bit
     }
     catch(...) {}                           ///> protect if any exeception
-    yield();                                ///> give other tasks some time
+    if (sched_n) sched_poll();              ///> fire periodic words that are due
+    if (ev_flag) ev_drain();                ///> handle deferred interrupts
+    BUDGET();                               ///> give other tasks some time
     IP0 = PFA(WP = rs.pop());               /// * restore call frame
     IP  = PMEM0 + rs.pop();
 }
+///
+/// periodic word scheduler (every, every-us)
+/// Note:
+///   * polled at the end of every nest() and while a VM waits in task_idle,
+///     a single compare against the earliest deadline when nothing is due
+///   * next deadline is advanced by the period from the schedule, not from
+///     when the word ran, so lateness never accumulates into drift
+///   * missed periods are skipped and counted as overruns
+///   * words run on the polling VM's stacks and must leave them balanced
+///   * one VM polls at a time (try_lock, the others just go on), timer[] is
+///     changed under the same lock, a word that fires may add or stop timers
+///
+#include <mutex>
+#define SCHED_MAX  8
+struct Timer {
+    U32 period, next;                       /// in microseconds
+    IU  xt;
+    U32 runs, over, jmin, jmax;             /// jitter = start - deadline, in us
+    DU2 jsum;
+};
+Timer timer[SCHED_MAX];
+std::atomic<int>     sched_n{0};            /// active timers
+std::atomic<U32>     sched_due{0};          /// earliest deadline
+std::recursive_mutex sched_mtx;             /// timer[], held by the polling VM
+VM_LOCAL bool        sched_in = false;      /// no nested firing
+
+void sched_poll() {
+    U32 now = micros();
+    if ((int)(now - sched_due) < 0 || sched_in || par_worker) return;
+    std::unique_lock<std::recursive_mutex> lk(sched_mtx, std::try_to_lock);
+    if (!lk.owns_lock()) return;            /// * another VM is polling
+    sched_in = true;
+    U32 due = now + 0x40000000;
+    sched_due = due;                        /// * sched_add from a word lowers it
+    for (int i = 0; i < SCHED_MAX; i++) {
+        Timer &t = timer[i];
+        if (!t.period) continue;
+        if ((int)(now - t.next) >= 0) {
+            U32 late = now - t.next;
+            if (late < t.jmin) t.jmin = late;
+            if (late > t.jmax) t.jmax = late;
+            t.jsum += late; t.runs++;
+            if (late >= t.period) {         /// * skip missed periods, keep phase
+                U32 k = late / t.period;
+                t.over += k; t.next += k * t.period;
+            }
+            t.next += t.period;
+            CALL(t.xt);
+            now = micros();
+        }
+        if (t.period && (int)(t.next - due) < 0) due = t.next;
+    }
+    if ((int)(due - sched_due) < 0) sched_due = due;
+    sched_in = false;
+}
+int sched_add(U32 us, IU xt) {
+    std::lock_guard<std::recursive_mutex> lk(sched_mtx);
+    for (int i = 0; i < SCHED_MAX; i++) {
+        Timer &t = timer[i];
+        if (t.period) continue;
+        t = {};
+        t.period = us ? us : 1; t.xt = xt; t.jmin = 0xffffffff;
+        t.next = micros() + t.period;
+        if (!sched_n++ || (int)(t.next - sched_due) < 0) sched_due = t.next;
+        return i + 1;
+    }
+    return 0;
+}
+Timer *sched_at(DU id) {                    /** with sched_mtx held */
+    return (id > 0 && id <= SCHED_MAX && timer[id-1].period) ? &timer[id-1] : NULL;
+}
+void sched_stop(DU id) {
+    std::lock_guard<std::recursive_mutex> lk(sched_mtx);
+    Timer *t = sched_at(id);
+    if (t) { t->period = 0; sched_n--; }
+}
 ///==============================================================================
 ///
 /// utilize C++ standard template libraries for core IO functions only
@@ -236,15 +587,23 @@ void nest(IU c) {
 #include <iomanip>      // setbase
 #include <string>       // string class
 using namespace std;    // default to C++ standard template library
-istringstream   fin;    // forth_in
-ostringstream   fout;   // forth_out
-string strbuf;          // input string buffer
-void (*fout_cb)(int, const char*);  // forth output callback function
+VM_LOCAL istringstream fin;    // forth_in
+VM_LOCAL ostringstream fout;   // forth_out
+VM_LOCAL string strbuf;        // input string buffer
+VM_LOCAL void (*fout_cb)(int, const char*);  // forth output callback function
+VM_LOCAL bool batch = false;   // batch mode, hold output until FOUT_CHUNK is filled
+#define FOUT_CHUNK 1024
+void fout_flush(bool force=false) {
+    if (!force && batch && fout.tellp() < FOUT_CHUNK) return;
+    string s = fout.str();
+    if (s.length()) fout_cb(s.length(), s.c_str());
+    fout.str("");
+}
 ///
 /// Arduino specific macros
 ///
 #define analogWrite(c,v,mx) ledcWrite((c),(8191/mx)*min((int)(v),mx))
-#define ENDL                endl; fout_cb(fout.str().length(), fout.str().c_str()); fout.str("")
+#define ENDL                endl; fout_flush()
 ///================================================================================
 /// debug functions
 ///
@@ -269,7 +628,11 @@ void see(IU *cp, IU *ip, int dp=0) {
     }
     switch (c) {
     case DOVAR: case DOLIT:
-        fout << "= " << *(DU*)(cp+1); *ip += sizeof(DU); break;
+        fout << "= " << *(DU*)CELLP(cp+1);
+        *ip += (CELLP(cp+1) - (U8*)(cp+1)) + sizeof(DU); break;
+    case DOFLIT:
+        fout << "= " << *(DF*)CELLP(cp+1);
+        *ip += (CELLP(cp+1) - (U8*)(cp+1)) + sizeof(DF); break;
     case DOSTR: case DOTSTR:
         fout << "= \"" << (char*)(cp+1) << '"';
         *ip += STRLEN((char*)(cp+1)); break;
@@ -280,8 +643,10 @@ void see(IU *cp, IU *ip, int dp=0) {
 }
 void words() {
     fout << setbase(16);
-    for (int i=0; i<dict.idx; i++) {
-        if ((i%10)==0) { fout << ENDL; yield(); }
+    for (int i=0, n=0; i<dict.idx; i++) {
+        if (i == base_didx && i < ovl_dlo) i = ovl_dlo;  /// * skip other VMs' overlays
+        if (i >= dict.idx) break;
+        if ((n++%10)==0) { fout << ENDL; yield(); }
         to_s(i);
     }
     fout << setbase(base);
@@ -314,10 +679,49 @@ void mem_dump(IU p0, DU sz) {
 ///
 /// macros to reduce verbosity
 ///
-inline char *next_word()  { fin >> strbuf; return (char*)strbuf.c_str(); } // get next idiom
-inline char *scan(char c) { getline(fin, strbuf, c); return (char*)strbuf.c_str(); }
+///
+/// pre-tokenized source (.tok) records, see tokenize_file()
+///   T_WORD len(1) chars   a word, or a name taken by next_word()
+///   T_STR  len(2) chars   text taken by scan(), e.g. the body of ." ..."
+///   T_LIT  4-byte cell    single literal
+///   T_DLIT 8-byte double  double literal
+///   T_EOL                 end of source line
+///
+enum TokType { T_EOL = 0, T_WORD, T_STR, T_LIT, T_DLIT };
+VM_LOCAL const U8 *tok = 0, *tok_end = 0;  /// replay cursor, 0 while reading text
+char *tok_text(U8 t) {                  /// take a T_WORD or T_STR record into strbuf
+    strbuf.clear();
+    if (tok < tok_end && *tok == t) {
+        int n = t == T_WORD ? tok[1] : (tok[1] | (tok[2] << 8));
+        tok += t == T_WORD ? 2 : 3;
+        strbuf.assign((const char*)tok, n);
+        tok += n;
+    }
+    return (char*)strbuf.c_str();
+}
+inline char *next_word()  {             // get next idiom
+    if (tok) return tok_text(T_WORD);
+    if (!(fin >> strbuf)) strbuf.clear();   /// * end of line, no stale word
+    return (char*)strbuf.c_str();
+}
+inline char *scan(char c) {
+    if (tok) return tok_text(T_STR);
+    getline(fin, strbuf, c); return (char*)strbuf.c_str();
+}
 inline DU   POP()         { DU n = top; top=ss.pop(); return n; }
-#define     PUSH(v)       { ss.push(top); top = v; }
+#define     PUSH(v)       { DU _v = (v); ss.push(top); top = _v; }  /** v first, it may read ss */
+///
+/// double cell on stack is ( lo hi ), hi on top
+///
+inline DU   dhi(DU2 n)    {                                  /** high cell of a double */
+    return sizeof(DU2) > sizeof(DU) ? (DU)(n >> (4*sizeof(DU2))) : (DU)(n < 0 ? -1 : 0);
+}
+inline DU2  DPOP()        {
+    DU hi = POP(); DU lo = POP();
+    return sizeof(DU2) > sizeof(DU)
+        ? (DU2)(((uint64_t)(uint32_t)hi << 32) | (uint32_t)lo) : (DU2)lo;
+}
+inline void DPUSH(DU2 d)  { PUSH((DU)d); PUSH(dhi(d)); }
 #if LAMBDA_OK
 #define     CODE(s, g)    { s, [](int c){ g; }, 0 }
 #define     IMMD(s, g)    { s, [](int c){ g; }, 1 }
@@ -331,6 +735,1003 @@ inline DU   POP()         { DU n = top; top=ss.pop(); return n; }
 ///
 #define     PEEK(a)    (DU)(*(DU*)((uintptr_t)(a)))
 #define     POKE(a, c) (*(DU*)((uintptr_t)(a))=(DU)(c))
+///
+/// pmem block access - range checked once per call instead of per byte
+///   return pointer to pmem[a], or NULL (with error report) if a..a+n is out of pmem
+///
+U8 *pmem_blk(DU a, DU n) {
+    if (a >= 0 && n >= 0 && (UDU)a + (UDU)n <= PMEM_SZ) return &pmem[ovl_va(a, n)];
+    fout << "ERR: pmem range " << a << "+" << n << ENDL;
+    return NULL;
+}
+///================================================================================
+///
+/// Q16.16 fixed-point helpers
+/// Note:
+///   * products and quotients go through DU2 and saturate instead of wrapping
+///   * qsin/qcos take radians, quarter-wave table with linear interpolation
+///
+#define FIXQ    16                          /** fraction bits of fixed-point value */
+inline DU qsat(DU2 v) {
+    const DU2 mx = (DU2)(((uint64_t)1 << (8*sizeof(DU)-1)) - 1);
+    return (DU)(v > mx ? mx : v < -mx-1 ? -mx-1 : v);
+}
+inline DU qmul(DU a, DU b)  { return qsat(((DU2)a * b) >> FIXQ); }
+inline DU qdiv(DU a, DU b)  {
+    if (b == 0) return qsat(a < 0 ? -((DU2)1 << 62) : ((DU2)1 << 62));
+    return qsat(((DU2)a << FIXQ) / b);
+}
+DU qsqrt(DU a) {                            /// bitwise integer sqrt of a << FIXQ
+    if (a <= 0) return 0;
+    uint64_t v = (uint64_t)a << FIXQ, r = 0, b = (uint64_t)1 << 62;
+    while (b > v) b >>= 2;
+    for (; b; b >>= 2) {
+        if (v >= r + b) { v -= r + b; r = (r >> 1) + b; }
+        else r >>= 1;
+    }
+    return (DU)r;
+}
+static const DU SINQ[65] PROGMEM = {        /// sin(i/64 * pi/2) in Q16
+        0,  1608,  3216,  4821,  6424,  8022,  9616, 11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+    36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+    46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+    54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+    64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+    65536
+};
+DU qsin(DU a) {
+    U16 p = (U16)(((DU2)a * 683565276) >> 32);  /// radians to turns, 65536 = 2pi
+    int q = p >> 14, x = p & 0x3fff;            /// quadrant, offset in quadrant
+    if (q & 1) x = 0x4000 - x;                  /// mirror 2nd and 4th quadrant
+    int i = x >> 8, f = x & 0xff;
+    DU  v = i < 64 ? SINQ[i] + (((SINQ[i+1] - SINQ[i]) * f) >> 8) : SINQ[64];
+    return q & 2 ? -v : v;
+}
+inline DU qcos(DU a) { return qsin(a + 102944); }   /// + pi/2 in Q16
+///================================================================================
+///
+/// cell-array kernels
+/// Note:
+///   * an array is n cells at pmem offset a, range checked once per call
+///   * reductions keep 4 partial results so the adds are not chained on one
+///     register, host gcc turns the loops into SSE/NEON code
+///
+#if defined(__x86_64__) || defined(__aarch64__)
+#define VEC_OPT   __attribute__((optimize("O3")))   /** host: auto-vectorise  */
+#else
+#define VEC_OPT                                     /** ESP32: no SIMD for DU */
+#endif
+inline DU *ARY(DU a, DU n) {                /** pmem array or NULL, n > PMEM_SZ fails the check */
+    return (DU*)pmem_blk(a, n > PMEM_SZ ? n : n * (DU)sizeof(DU));
+}
+VEC_OPT DU a_sum(const DU *a, DU n) {
+    DU s0 = 0, s1 = 0, s2 = 0, s3 = 0, i = 0;
+    for (; i + 4 <= n; i += 4) { s0 += a[i]; s1 += a[i+1]; s2 += a[i+2]; s3 += a[i+3]; }
+    for (; i < n; i++) s0 += a[i];
+    return s0 + s1 + s2 + s3;
+}
+VEC_OPT DU a_dot(const DU *a, const DU *b, DU n) {
+    DU s0 = 0, s1 = 0, s2 = 0, s3 = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        s0 += a[i] * b[i];     s1 += a[i+1] * b[i+1];
+        s2 += a[i+2] * b[i+2]; s3 += a[i+3] * b[i+3];
+    }
+    for (; i < n; i++) s0 += a[i] * b[i];
+    return s0 + s1 + s2 + s3;
+}
+VEC_OPT void a_minmax(const DU *a, DU n, DU *lo, DU *hi) {
+    DU l = a[0], h = a[0];
+    for (DU i = 1; i < n; i++) { l = a[i] < l ? a[i] : l; h = a[i] > h ? a[i] : h; }
+    *lo = l; *hi = h;
+}
+VEC_OPT void a_scale(DU *a, DU n, DU k)  { for (DU i = 0; i < n; i++) a[i] *= k; }
+VEC_OPT void a_fill(DU *a, DU n, DU v)   { for (DU i = 0; i < n; i++) a[i] = v; }
+VEC_OPT void a_add(const DU *a, const DU *b, DU *c, DU n) {
+    for (DU i = 0; i < n; i++) c[i] = a[i] + b[i];
+}
+VEC_OPT void a_clamp(DU *a, DU n, DU lo, DU hi) {
+    for (DU i = 0; i < n; i++) a[i] = a[i] < lo ? lo : a[i] > hi ? hi : a[i];
+}
+///================================================================================
+///
+/// sorting and searching cell arrays
+/// Note:
+///   * introsort: median-of-3 quicksort, heapsort after 2*log2(n) levels,
+///     insertion sort for 16 cells or less
+///   * every scan is bounds checked, a bad sort-by comparator gives a wrong
+///     order but never runs off the array
+///   * sort-by calls its xt through CALL, i.e. straight into nest()
+///
+struct LtNum { bool operator()(DU x, DU y) const { return x < y; } };
+struct LtXt  {                              /** Forth comparator ( x y -- f ) */
+    IU xt;
+    bool operator()(DU x, DU y) const { PUSH(x); PUSH(y); CALL(xt); return POP() != 0; }
+};
+inline void dswap(DU *a, int i, int j) { DU t = a[i]; a[i] = a[j]; a[j] = t; }
+template<class LT>
+void sift(DU *a, int i, int n, LT lt) {
+    for (int c; (c = 2 * i + 1) < n; i = c) {
+        if (c + 1 < n && lt(a[c], a[c+1])) c++;
+        if (!lt(a[i], a[c])) return;
+        dswap(a, i, c);
+    }
+}
+template<class LT>
+void heap_sort(DU *a, int n, LT lt) {
+    for (int i = n / 2 - 1; i >= 0; i--) sift(a, i, n, lt);
+    for (int k = n - 1; k > 0; k--) { dswap(a, 0, k); sift(a, 0, k, lt); }
+}
+template<class LT>
+void intro_sort(DU *a, int n, int depth, LT lt) {
+    while (n > 16) {
+        if (depth-- == 0) { heap_sort(a, n, lt); return; }
+        int m = (n - 1) / 2;                /// * median of 3 into a[m]
+        if (lt(a[m], a[0]))   dswap(a, 0, m);
+        if (lt(a[n-1], a[m])) { dswap(a, m, n-1); if (lt(a[m], a[0])) dswap(a, 0, m); }
+        DU p = a[m];
+        int i = -1, j = n;                  /// * Hoare partition
+        for (;;) {
+            do i++; while (i < n - 1 && lt(a[i], p));
+            do j--; while (j > 0 && lt(p, a[j]));
+            if (i >= j) break;
+            dswap(a, i, j);
+        }
+        int k = j + 1;                      /// * recurse into smaller half, loop on the other
+        if (k < n - k) { intro_sort(a, k, depth, lt); a += k; n -= k; }
+        else           { intro_sort(a + k, n - k, depth, lt); n = k; }
+    }
+    for (int i = 1; i < n; i++) {           /// * insertion sort the rest
+        DU v = a[i]; int j = i;
+        for (; j > 0 && lt(v, a[j-1]); j--) a[j] = a[j-1];
+        a[j] = v;
+    }
+}
+template<class LT>
+void a_sort(DU *a, DU n, LT lt) {
+    int d = 0;
+    for (DU k = n; k > 1; k >>= 1) d += 2;
+    intro_sort(a, n, d, lt);
+}
+int a_lbound(const DU *a, int n, DU x) {    /** first index with a[i] >= x */
+    int lo = 0;
+    while (n > 0) {
+        int h = n >> 1;
+        if (a[lo + h] < x) { lo += h + 1; n -= h + 1; }
+        else n = h;
+    }
+    return lo;
+}
+///
+/// running median over a window of w samples
+///   s = [ count, head, ring[w], sorted[w] ], 2*w+2 cells zeroed before first use
+///   each sample costs two binary searches and two memmoves of the sorted window
+///
+DU a_rmedian(DU *s, DU w, DU x) {
+    DU *ring = s + 2, *srt = s + 2 + w;
+    if (s[0] < 0 || s[0] > w || s[1] < 0 || s[1] >= w) s[0] = s[1] = 0;  /// * bad state
+    if (s[0] == w) {                        /// * window full, drop the oldest
+        int i = a_lbound(srt, s[0], ring[s[1]]);
+        if (i < s[0]) memmove(&srt[i], &srt[i+1], (s[0] - i - 1) * sizeof(DU));
+        s[0]--;
+    }
+    ring[s[1]] = x;
+    s[1] = (s[1] + 1) % w;
+    int i = a_lbound(srt, s[0], x);         /// * insert into sorted window
+    memmove(&srt[i+1], &srt[i], (s[0] - i) * sizeof(DU));
+    srt[i] = x;
+    return srt[(s[0]++) / 2];
+}
+///================================================================================
+///
+/// hash maps - open addressing, linear probing, tables on the heap
+/// Note:
+///   * a map is a handle 1..MAP_MAX, keys are cells, or pmem offsets of
+///     0-terminated strings (kept by reference) for a map-new$ map
+///   * at half load the bigger table is allocated uncleared, every later
+///     operation clears 2*MAP_STEP of its slots, then moves MAP_STEP slots of
+///     the old one across, so no single put zeroes or rehashes it all
+///   * lookups try the new table first, then the one being drained
+///   * puts stop at 7/8 load, the clearing and moving finish well before
+///   * map-new and map-free lock the table, but a map itself is not locked:
+///     use it from one VM (and its tasks, which run one at a time), not from
+///     par-for workers or other VMs, even a get may move slots, pass the
+///     data through a channel instead
+///
+#define MAP_MAX   16
+#define MAP_STEP  8                         /** old slots moved per map operation */
+struct MapSlot { DU key, val; U32 hash; };  /// hash 0: empty, 1: deleted
+struct MapTab  { MapSlot *s; int cap, used, live; };
+struct Map     { MapTab cur, old, nxt; int mig, clr; bool on, str, busy; };
+Map maps[MAP_MAX];
+mutex map_mtx;                              /// maps[] slots, other VMs may be allocating
+
+Map *map_at(DU h) {
+    if (h > 0 && h <= MAP_MAX && maps[h-1].on) return &maps[h-1];
+    fout << "ERR: bad map " << h << ENDL;
+    return NULL;
+}
+bool map_key(Map &m, DU k) {                /** string key must end inside pmem */
+    if (!m.str) return true;
+    if (pmem_blk(k, 1) && memchr(&pmem[k], 0, PMEM_SZ - k)) return true;
+    return false;
+}
+U32 map_hash(Map &m, DU k) {
+    U32 h = 2166136261u;                    /// FNV-1a for strings
+    if (m.str) for (const U8 *p = &pmem[k]; *p; p++) h = (h ^ *p) * 16777619u;
+    else {                                  /// Fibonacci hash for cells
+        h = (U32)((uint64_t)k ^ ((uint64_t)k >> 32)) * 2654435769u;
+        h ^= h >> 16;
+    }
+    return h < 2 ? h + 2 : h;
+}
+inline bool map_eq(Map &m, DU a, DU b) {
+    return m.str ? strcmp((const char*)&pmem[a], (const char*)&pmem[b]) == 0 : a == b;
+}
+int tab_find(Map &m, MapTab &t, DU k, U32 h) {
+    for (int n = 0, i = h & (t.cap - 1); n < t.cap; n++, i = (i + 1) & (t.cap - 1)) {
+        MapSlot &s = t.s[i];
+        if (s.hash == 0) break;
+        if (s.hash == h && map_eq(m, s.key, k)) return i;
+    }
+    return -1;
+}
+void tab_add(MapTab &t, DU k, DU v, U32 h) { /** key not in t, t has room */
+    int i = h & (t.cap - 1);
+    while (t.s[i].hash > 1) i = (i + 1) & (t.cap - 1);
+    if (t.s[i].hash == 0) t.used++;
+    t.s[i] = { k, v, h };
+    t.live++;
+}
+void map_step(Map &m) {                     /** clear or move a few slots */
+    if (m.busy) return;
+    if (m.nxt.cap) {                        /// * clear the next table
+        int n = min(2 * MAP_STEP, m.nxt.cap - m.clr);
+        memset(&m.nxt.s[m.clr], 0, n * sizeof(MapSlot));
+        if ((m.clr += n) < m.nxt.cap) return;
+        m.old = m.cur; m.mig = 0;           /// * cleared, drain cur into it
+        m.cur = m.nxt;
+        m.nxt = {};
+        return;
+    }
+    if (!m.old.cap) return;
+    for (int n = 0; n < MAP_STEP && m.mig < m.old.cap; n++, m.mig++) {
+        MapSlot &s = m.old.s[m.mig];
+        if (s.hash < 2) continue;
+        tab_add(m.cur, s.key, s.val, s.hash);
+        s.hash = 1; m.old.live--;
+    }
+    if (m.mig < m.old.cap) return;
+    free(m.old.s);
+    m.old = {};
+}
+bool map_grow(Map &m) {                     /** make room for one more key */
+    if (!m.cur.cap) {                       /// * first table, small enough to zero
+        MapSlot *s = (MapSlot*)calloc(8, sizeof(MapSlot));
+        if (!s) { fout << "ERR: map full" << ENDL; return false; }
+        m.cur = { s, 8, 0, 0 };
+    }
+    if (!m.old.cap && !m.nxt.cap && m.cur.used * 2 >= m.cur.cap) {
+        int cap = m.cur.cap;                /// * never shrink, so the move
+        while (cap < (m.cur.live + 1) * 4) cap <<= 1;     ///   finishes before it fills up
+        MapSlot *s = (MapSlot*)malloc(cap * sizeof(MapSlot));   /// * map_step clears it
+        if (s) { m.nxt = { s, cap, 0, 0 }; m.clr = 0; }
+    }
+    if ((m.cur.used + 1) * 8 <= m.cur.cap * 7) return true;
+    fout << "ERR: map full" << ENDL;
+    return false;
+}
+int map_new(bool str) {
+    lock_guard<mutex> lk(map_mtx);
+    for (int i = 0; i < MAP_MAX; i++) {
+        if (maps[i].on) continue;
+        maps[i] = {}; maps[i].on = true; maps[i].str = str;
+        return i + 1;
+    }
+    fout << "ERR: too many maps" << ENDL;
+    return 0;
+}
+void map_free(Map &m) {
+    lock_guard<mutex> lk(map_mtx);
+    free(m.cur.s); free(m.old.s); free(m.nxt.s); m = {};
+}
+void map_put(Map &m, DU k, DU v) {
+    map_step(m);
+    U32 h = map_hash(m, k);
+    int i = m.cur.cap ? tab_find(m, m.cur, k, h) : -1;
+    if (i >= 0) { m.cur.s[i].val = v; return; }
+    if (m.old.cap && (i = tab_find(m, m.old, k, h)) >= 0) {
+        m.old.s[i].hash = 1; m.old.live--;  /// * re-home it in the new table
+    }
+    if (map_grow(m)) tab_add(m.cur, k, v, h);
+}
+MapSlot *map_get(Map &m, DU k) {
+    map_step(m);
+    U32 h = map_hash(m, k);
+    int i;
+    if (m.cur.cap && (i = tab_find(m, m.cur, k, h)) >= 0) return &m.cur.s[i];
+    if (m.old.cap && (i = tab_find(m, m.old, k, h)) >= 0) return &m.old.s[i];
+    return NULL;
+}
+bool map_del(Map &m, DU k) {
+    MapSlot *s = map_get(m, k);
+    if (!s) return false;
+    s->hash = 1;
+    if (s >= m.cur.s && s < m.cur.s + m.cur.cap) m.cur.live--;
+    else m.old.live--;
+    return true;
+}
+void map_each(Map &m, IU xt) {              /** xt ( k v -- ), map is read-only meanwhile */
+    m.busy = true;
+    MapTab *tab[] = { &m.cur, &m.old };
+    for (MapTab *t : tab) {
+        for (int i = 0; i < t->cap; i++) {
+            if (t->s[i].hash < 2) continue;
+            PUSH(t->s[i].key); PUSH(t->s[i].val);
+            CALL(xt);
+        }
+    }
+    m.busy = false;
+}
+///================================================================================
+///
+/// coroutines - coroutine ( xt -- co ), resume ( x co -- y f ), yield-co ( y -- x )
+/// Note:
+///   * co_run() is a flat inner interpreter, colon calls push the same
+///     (IP, WP) frame nest() does but on rs instead of the C stack, so the
+///     coroutine can stop at any depth and its frames are plain cells
+///   * a suspended coroutine keeps its stacks in its own small ss/rs
+///     segments, resume copies them on top of the resumer's stacks and back,
+///     so a switch costs about what a nest() does
+///   * the first resume passes x to xt ( x -- ), later ones return it from
+///     yield-co, f is false once xt has returned (y = 0)
+///   * tasks are coroutines too, resumed without x (see task_go)
+///   * exec of a colon word is flat too, yield-co must be called by co_run()
+///     itself, not from under map-each, sort-by... which nest() on the C stack
+///   * coro[] is shared by all VMs, taking a slot and every change of st
+///     are under co_mtx, so a coroutine runs in one VM at a time
+///
+#define CO_MAX    16
+#define CO_SS     16                        /** cells of ss kept per coroutine */
+#define CO_RS     16                        /** cells of rs kept per coroutine */
+enum { CO_FREE = 0, CO_NEW, CO_SUSP, CO_RUN, CO_DONE };
+struct Co {
+    int st;
+    IU  xt, WP;                             /// entry word, current word
+    int ip;                                 /// IP offset in pmem
+    int sn, rn;                             /// cells in ss, rs
+    DU  ss[CO_SS], rs[CO_RS];
+};
+Co  coro[CO_MAX];
+mutex co_mtx;                               /// coro[] slots, Co.st
+VM_LOCAL Co  *co_me  = NULL;                /// coroutine running in this VM
+VM_LOCAL U8  *co_ip  = NULL;                /// IP of co_run's primitive call
+VM_LOCAL bool co_out = false;               /// yield-co was called
+VM_LOCAL DU   co_val = 0;                   /// value passed by yield-co
+
+Co *co_at(DU h) {
+    if (h > 0 && h <= CO_MAX && coro[h-1].st) return &coro[h-1];
+    fout << "ERR: bad coroutine " << h << ENDL;
+    return NULL;
+}
+int co_new(IU xt) {
+    if (xt >= dict.idx || !dict[xt].def) { fout << "ERR: coroutine needs a colon word" << ENDL; return 0; }
+    {
+        lock_guard<mutex> lk(co_mtx);       /// * other VMs may be allocating
+        for (int i = 0; i < CO_MAX; i++) {
+            if (coro[i].st) continue;
+            coro[i] = {};
+            coro[i].st = CO_NEW; coro[i].xt = xt;
+            return i + 1;
+        }
+    }
+    fout << "ERR: too many coroutines" << ENDL;
+    return 0;
+}
+int co_take(Co &c) {                        /** st it had, CO_RUN now if it was runnable */
+    lock_guard<mutex> lk(co_mtx);
+    int st = c.st;
+    if (st == CO_NEW || st == CO_SUSP) c.st = CO_RUN;
+    return st;
+}
+void co_free(Co &c) {
+    lock_guard<mutex> lk(co_mtx);
+    if (c.st != CO_RUN) c = {};
+}
+bool co_run(int rbase) {                    /** true at yield-co, false when xt returns */
+    static IU xe = find("exec");
+    U8 *ipx = IP0 + PFLEN(WP);
+    for (;;) {
+        while (IP >= ipx) {                 /// * end of a colon word, unnest
+            if (sched_n) sched_poll();
+            if (ev_flag) ev_drain();
+            BUDGET();
+            if (rs.idx == rbase) return false;
+            IP0 = PFA(WP = rs.pop());
+            IP  = PMEM0 + rs.pop();
+            ipx = IP0 + PFLEN(WP);
+        }
+        IU c = *(IU*)IP; IP += sizeof(IU);
+        budget--;
+        if (c == xe && (IU)top < dict.idx && dict[(IU)top].def) c = POP();
+        if (dict[c].def) {                  /// * nest without recursion
+            rs.push(IP - PMEM0); rs.push(WP);
+            IP0 = IP = PFA(WP = c);
+            ipx = IP + PFLEN(c);
+            continue;
+        }
+        co_ip = IP;
+        (*(fop)(((uintptr_t)dict[c].xt)&~0x3))();
+        if (co_out) { co_out = false; return true; }
+    }
+}
+bool co_resume(Co &c, DU &x, bool arg=true) { /** x in, y out, false when done */
+    int st = co_take(c);
+    if (st != CO_NEW && st != CO_SUSP) {    /// * done, freed meanwhile, or running
+        if (st == CO_RUN) fout << "ERR: coroutine running" << ENDL;
+        x = 0;
+        return false;
+    }
+    Co *me = co_me;                         /// * caller's registers, like nest()
+    U8 *ip = IP, *ip0 = IP0;
+    IU  wp = WP;
+    ss.push(top);
+    int sbase = ss.idx, rbase = rs.idx;
+    if (st == CO_NEW) {
+        if (arg) { ss.push(-1); top = x; }  /// * xt ( x -- ) on a fresh stack
+        else top = -1;                      /// * or ( -- )
+        IP0 = IP = PFA(WP = c.xt);
+    }
+    else {
+        ss.push(c.ss, c.sn);                /// * x is what yield-co returns
+        top = arg ? x : ss.pop();           /// * or the parked top
+        rs.push(c.rs, c.rn);
+        WP = c.WP; IP0 = PFA(WP); IP = PMEM0 + c.ip;
+    }
+    co_me = &c;
+    bool ok = false;
+    try { ok = co_run(rbase); }
+    catch(...) {}                           ///> the coroutine dies, the caller goes on
+    x  = ok ? co_val : 0;
+    c.sn = ss.idx - sbase; c.rn = rs.idx - rbase;
+    if (ok && (c.sn > CO_SS || c.rn > CO_RS)) {
+        fout << "ERR: coroutine stack full" << ENDL;
+        ok = false;
+    }
+    if (ok) {                               /// * park the segments
+        memcpy(c.ss, &ss[sbase], c.sn * sizeof(DU));
+        memcpy(c.rs, &rs[rbase], c.rn * sizeof(DU));
+        c.WP = WP; c.ip = (int)(IP - PMEM0);
+    }
+    {
+        lock_guard<mutex> lk(co_mtx);
+        c.st = ok ? CO_SUSP : CO_DONE;
+    }
+    ss.clear(sbase); rs.clear(rbase);
+    top = ss.pop();
+    co_me = me; WP = wp; IP = ip; IP0 = ip0;
+    return ok;
+}
+void co_yield() {                           /** ( y -- ), back to resume */
+    if (!co_me || IP != co_ip) {
+        fout << "ERR: yield-co outside a coroutine" << ENDL;
+        return;
+    }
+    co_val = POP();
+    ss.push(top);                           /// * top is parked with the rest
+    co_out = true;
+}
+///================================================================================
+///
+/// cooperative multitasker - round robin, one task runs at a time
+/// Note:
+///   * a task is a coroutine of the VM that activated it (see co_resume),
+///     its IP, WP and stack segments are swapped in and out on the VM's own
+///     thread, so a switch costs about a nest() and no thread is handed over
+///   * a VM runs a round of its ready tasks whenever it waits itself (pause,
+///     sleep-ms, delay, key, a blocked channel end, loop's idle time), each
+///     task runs up to its own next pause
+///   * pause, stop, sleep-ms, delay and the waiting channel words called by
+///     the task's co_run() itself park the task, a channel word is run again
+///     once resumed (see task_block), called from under map-each, sort-by...
+///     (nest() on the C stack) they run the other tasks until done instead,
+///     the VM goes on only once the task is back at its own level
+///   * task[].st is written under task_mtx, another VM may wake a task
+///
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#define TASK_MAX  8
+enum { TK_FREE = 0, TK_IDLE, TK_READY, TK_STOP, TK_SLEEP };
+struct Task {
+    int   st;
+    U32   wake;                         /// SLEEP until, or a blocked word's deadline
+    bool  blk;                          /// a channel word waits, see task_block
+    void *vm;                           /// owner VM, its thread_local ss
+    Co    co;                           /// registers and stack segments
+};
+Task task[TASK_MAX] = {};               /// 1..TASK_MAX-1, 0 is the VM itself
+VM_LOCAL int task_me = 0;               /// task running on this VM, 0 if none
+mutex task_mtx;
+void vm_reset();                        /// see forth_init
+DU   vm_key();                          /// see vm_poll, key waits for the console
+#ifdef ESP_PLATFORM
+#include "esp_pthread.h"
+#define TASK_STACK 8192                 /** nest() recursion, pthread default is 3K */
+void thread_cfg() {                     /** stack of the next std::thread we start */
+    esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
+    cfg.stack_size = TASK_STACK;
+    esp_pthread_set_cfg(&cfg);
+}
+#else  // ESP_PLATFORM
+void thread_cfg() {}
+#endif // ESP_PLATFORM
+
+int task_st(int i) {
+    lock_guard<mutex> lk(task_mtx);
+    return task[i].st;
+}
+void task_set(int i, int st) {
+    lock_guard<mutex> lk(task_mtx);
+    task[i].st = st;
+}
+bool task_ready(int i) {                /** task i is this VM's and can run now */
+    lock_guard<mutex> lk(task_mtx);
+    Task &t = task[i];
+    if (t.vm != &ss || t.co.st == CO_RUN) return false;    /// * not ours, or under us
+    if (t.st == TK_SLEEP && (int)((U32)millis() - t.wake) >= 0) t.st = TK_READY;
+    return t.st == TK_READY;
+}
+bool task_top() {                       /** called by the running task's co_run() */
+    return task_me && co_me == &task[task_me].co && IP == co_ip;
+}
+void task_park() {                      /** back to task_go once this word returns */
+    ss.push(top);                       /// * top is parked with the rest, as in yield-co
+    co_out = true;
+}
+void task_go(int i) {                   /** run task i up to its next pause */
+    Task &t = task[i];
+    string o = fout.str();              /// * the VM's pending output waits
+    auto cb = fout_cb; bool bt = batch;
+    fout.str(""); batch = false;
+    fout_cb = [](int, const char *s) { Serial.print(s); };
+    int me = task_me; task_me = i;
+    DU x = 0;
+    bool ok = co_resume(t.co, x, false);
+    task_me = me;
+    fout_flush(true);
+    fout_cb = cb; batch = bt; fout << o;
+    if (!ok) { t.co = {}; task_set(i, TK_FREE); }   /// * xt returned, or died
+}
+int task_round() {                      /** each ready task of this VM once */
+    int n = 0;
+    for (int i = 1; i < TASK_MAX; i++) {
+        if (task_ready(i)) { task_go(i); n++; }
+    }
+    return n;
+}
+void task_idle(U32 ms) {                /** run the tasks, timers and events for ms */
+    U32 t0 = millis();
+    for (;;) {
+        if (sched_n) sched_poll();
+        if (ev_flag) ev_drain();
+        int n = task_round();
+        if ((U32)millis() - t0 >= ms) break;
+        if (n) yield();
+        else   delay(1);                /// * everyone asleep, wait for a timer
+    }
+    yield();
+}
+void task_switch() {                    /** let the others run, back when ready again */
+    if (task_top()) task_park();
+    else task_idle(0);
+}
+void task_sleep(U32 ms) {
+    if (!task_top()) { task_idle(ms); return; }
+    lock_guard<mutex> lk(task_mtx);
+    task[task_me].wake = (U32)millis() + ms;
+    task[task_me].st   = TK_SLEEP;
+    task_park();
+}
+void task_stop() {
+    if (!task_me) { task_idle(0); return; } /// * the VM itself never stops
+    task_set(task_me, TK_STOP);
+    if (task_top()) { task_park(); return; }
+    while (task_st(task_me) == TK_STOP) task_idle(1);  /// * under a word, wait for wake
+}
+void task_wake(DU t) {
+    if (t <= 0 || t >= TASK_MAX) return;
+    lock_guard<mutex> lk(task_mtx);
+    if (task[t].st >= TK_STOP) task[t].st = TK_READY;
+}
+bool task_block(bool ready, DU *ms) {   /** park until ready, true if parked */
+    if (!task_top()) return false;      /// * the word waits in place
+    Task &t = task[task_me];
+    if (ready || (ms && *ms == 0)) { t.blk = false; return false; }
+    U32 now = millis();
+    if (!t.blk) { t.blk = true; t.wake = now + (ms ? *ms : 0); }
+    else if (ms && *ms > 0 && (int)(now - t.wake) >= 0) {
+        t.blk = false; *ms = 0;         /// * timed out, the word fails at once
+        return false;
+    }
+    IP -= sizeof(IU);                   /// * resumed at this word again
+    task_park();
+    return true;
+}
+int task_new() {
+    unique_lock<mutex> lk(task_mtx);
+    for (int i = 1; i < TASK_MAX; i++) {
+        if (task[i].st != TK_FREE) continue;
+        task[i].st = TK_IDLE;
+        return i;
+    }
+    fout << "ERR: too many tasks" << ENDL;
+    return 0;
+}
+void task_activate(IU xt, DU t) {
+    lock_guard<mutex> lk(task_mtx);
+    if (t <= 0 || t >= TASK_MAX || task[t].st != TK_IDLE) {
+        fout << "ERR: bad task " << t << ENDL;
+        return;
+    }
+    if (xt >= dict.idx || !dict[xt].def) {
+        fout << "ERR: task needs a colon word" << ENDL;
+        return;
+    }
+    Task &k = task[t];
+    k.co = {}; k.co.st = CO_NEW; k.co.xt = xt;
+    k.vm = &ss; k.blk = false;
+    k.st = TK_READY;
+}
+///================================================================================
+///
+/// channels - bounded FIFOs of cells between tasks and VMs
+/// Note:
+///   * a chan-new channel has one sender and one receiver, its ring is
+///     lock-free (head is written by the sender only, tail by the receiver)
+///   * a chan-new-mp channel takes any number of both, each end locks mtx
+///   * a blocked end parks its task (see task_block), or runs the VM's
+///     tasks, events and timers, until the channel is ready or ms runs out,
+///     ms < 0 waits forever
+///   * chan-free of a channel an end is waiting on only shuts it, the
+///     waiting ends give up and the last one out frees the ring
+///
+#define CHAN_MAX  16
+struct Chan {
+    DU          *q;                         /// depth cells, power of 2, NULL = free
+    U32         mask;
+    bool        mp;                         /// many producers, locked ring
+    int         wait;                       /// ends in chan_wait, under task_mtx
+    atomic<bool> shut{false};               /// freed while ends were waiting
+    atomic<U32> head{0}, tail{0};
+    mutex       mtx;
+};
+Chan chans[CHAN_MAX];
+VM_LOCAL U32 chan_rr = 0;                   /// chan-select start
+
+Chan *chan_at(DU h) {
+    if (h > 0 && h <= CHAN_MAX && chans[h-1].q && !chans[h-1].shut) return &chans[h-1];
+    fout << "ERR: bad channel " << h << ENDL;
+    return NULL;
+}
+int chan_new(DU n, bool mp) {
+    if (n < 1 || n > 0x10000) { fout << "ERR: bad depth " << n << ENDL; return 0; }
+    U32 d = 1;
+    while (d < (U32)n) d <<= 1;
+    lock_guard<mutex> lk(task_mtx);         /// * other VMs may be allocating
+    for (int i = 0; i < CHAN_MAX; i++) {
+        Chan &c = chans[i];
+        if (c.q) continue;
+        if (!(c.q = (DU*)malloc(d * sizeof(DU)))) break;
+        c.mask = d - 1; c.mp = mp; c.head = 0; c.tail = 0;
+        return i + 1;
+    }
+    fout << "ERR: too many channels" << ENDL;
+    return 0;
+}
+void chan_free(Chan &c) {
+    lock_guard<mutex> lk(task_mtx);
+    if (c.wait) { c.shut = true; return; }  /// * see chan_drop
+    free(c.q); c.q = NULL;
+}
+bool chan_hold(Chan **c, int n) {           /** count a waiter on each, false if one is gone */
+    lock_guard<mutex> lk(task_mtx);
+    bool ok = true;
+    for (int i = 0; i < n; i++) {
+        c[i]->wait++;
+        if (!c[i]->q || c[i]->shut) ok = false;
+    }
+    return ok;
+}
+void chan_drop(Chan **c, int n) {           /** last waiter out frees a shut channel */
+    lock_guard<mutex> lk(task_mtx);
+    for (int i = 0; i < n; i++) {
+        Chan &x = *c[i];
+        if (--x.wait || !x.shut) continue;
+        free(x.q); x.q = NULL; x.shut = false;
+    }
+}
+bool chan_ready(DU h, bool tx) {            /** send (tx) or receive would not wait */
+    if (h <= 0 || h > CHAN_MAX || !chans[h-1].q || chans[h-1].shut) return true;  /// * the word reports it
+    Chan &c = chans[h-1];
+    U32 n = c.head.load() - c.tail.load();
+    return tx ? n <= c.mask : n > 0;
+}
+bool chan_ready_n(DU n) {                   /** ( ch1 .. chn n ms ) one can be received */
+    if (n <= 0 || n > CHAN_MAX || n + 2 > ss.idx) return true;
+    for (int k = 2; k < n + 2; k++) {
+        if (chan_ready(ss.top(k), false)) return true;
+    }
+    return false;
+}
+bool chan_put(Chan &c, DU v) {
+    unique_lock<mutex> lk(c.mtx, defer_lock);
+    if (c.mp) lk.lock();
+    U32 h = c.head.load(memory_order_relaxed);
+    if (h - c.tail.load(memory_order_acquire) > c.mask) return false;
+    c.q[h & c.mask] = v;
+    c.head.store(h + 1, memory_order_release);
+    return true;
+}
+bool chan_get(Chan &c, DU &v) {
+    unique_lock<mutex> lk(c.mtx, defer_lock);
+    if (c.mp) lk.lock();
+    U32 r = c.tail.load(memory_order_relaxed);
+    if (c.head.load(memory_order_acquire) == r) return false;
+    v = c.q[r & c.mask];
+    c.tail.store(r + 1, memory_order_release);
+    return true;
+}
+template<class F>
+bool chan_wait(DU ms, F ready, Chan **c, int n) {  /** poll ready() until true, ms passed or c shut */
+    U32 t0 = millis();
+    if (ready()) return true;               /// * no bookkeeping if it need not wait
+    bool ok = chan_hold(c, n);              /// * c[] stays allocated till chan_drop
+    while (ok && !ready()) {
+        if (ms >= 0 && (U32)millis() - t0 >= (U32)ms) { ok = false; break; }
+        task_idle(0);                       /// * may run a chan-free
+        for (int i = 0; i < n; i++) {
+            if (c[i]->shut) ok = false;
+        }
+    }
+    chan_drop(c, n);
+    return ok;
+}
+bool chan_send(DU h, DU v, DU ms) {
+    Chan *c = chan_at(h);
+    return c && chan_wait(ms, [&]{ return chan_put(*c, v); }, &c, 1);
+}
+bool chan_recv(DU h, DU &v, DU ms) {
+    Chan *c = chan_at(h);
+    v = 0;
+    return c && chan_wait(ms, [&]{ return chan_get(*c, v); }, &c, 1);
+}
+DU chan_select(int n, DU ms, DU &v) {       /** ( ch1 .. chn -- ), ch ready or 0 */
+    Chan *c[CHAN_MAX];
+    DU   h[CHAN_MAX];
+    bool ok = n > 0 && n <= CHAN_MAX;
+    for (int i = n - 1; i >= 0; i--) {      /// * always take all n off the stack
+        DU x = POP();
+        if (ok && !(c[i] = chan_at(h[i] = x))) ok = false;
+    }
+    v = 0;
+    if (!ok) return 0;
+    int k = chan_rr++ % n;                  /// * rotate the first one, no starvation
+    auto ready = [&]{
+        for (int j = 0; j < n; j++) {
+            int i = (k + j) % n;
+            if (chan_get(*c[i], v)) { k = i; return true; }
+        }
+        return false;
+    };
+    return chan_wait(ms, ready, c, n) ? h[k] : 0;
+}
+///================================================================================
+///
+/// parallel for - par-for ( n xt -- ) runs xt ( i -- ) for i = 0..n-1
+/// Note:
+///   * workers are threads with their own VM on the caller's dictionary view,
+///     kept in a pool between calls, the caller itself is worker 0
+///   * [0, n) is split into one range per worker, a worker takes PAR_GRAIN
+///     indices at a time off the front of its own range and, once it is
+///     empty, steals the back half of the fullest other range
+///   * a range is hi << 32 | lo in one 64-bit atomic, so a take or a steal
+///     is one compare-exchange
+///   * xt must not pause or compile, periodic words and interrupt handlers
+///     wait for the join, a par-for inside xt runs serially
+///   * par and the pool serve one job at a time, a par-for of another VM
+///     while a job runs does its loop serially instead of waiting
+///
+#define PAR_MAX   8
+#define PAR_GRAIN 16
+struct ParJob {
+    IU  xt;
+    int didx, here, oid, dlo, plo, base, np;    /// caller's dict view
+    int nw;                                 /// workers in this job
+    int busy;                               /// pool workers not done yet
+    U32 gen;                                /// job number, wakes the pool
+    atomic<uint64_t> rng[PAR_MAX];          /// hi << 32 | lo
+    atomic<U32>      steals;
+} par;
+int                par_pool = 0;            /// pool threads started
+int                par_nw   = 0;            /// workers per job, 0 = all cores
+mutex              par_job;                 /// owns par and the pool, setup till join
+mutex              par_mtx;
+condition_variable par_go, par_done;
+VM_LOCAL bool      par_worker = false;
+
+bool par_take(int w, U32 &lo, U32 &hi) {    /** next chunk for worker w */
+    for (;;) {
+        uint64_t r = par.rng[w].load();
+        U32 l = (U32)r, h = (U32)(r >> 32);
+        if (l < h) {                        /// * own range first
+            U32 e = l + min<U32>(PAR_GRAIN, h - l);
+            if (!par.rng[w].compare_exchange_weak(r, (uint64_t)h << 32 | e)) continue;
+            lo = l; hi = e;
+            return true;
+        }
+        int v = -1; U32 most = 0;           /// * then the fullest other one
+        for (int i = 0; i < par.nw; i++) {
+            uint64_t x = par.rng[i].load();
+            U32 xl = (U32)x, xh = (U32)(x >> 32);
+            if (xl < xh && xh - xl > most) { most = xh - xl; v = i; }
+        }
+        if (v < 0) return false;
+        uint64_t x = par.rng[v].load();
+        U32 xl = (U32)x, xh = (U32)(x >> 32);
+        if (xl >= xh) continue;
+        U32 m = xl + (xh - xl) / 2;         /// * take [m, xh), a single index too
+        if (!par.rng[v].compare_exchange_weak(x, (uint64_t)m << 32 | xl)) continue;
+        par.rng[w].store((uint64_t)xh << 32 | m);   /// * empty ones are never stolen
+        par.steals++;
+    }
+}
+void par_work(int w) {
+    par_worker = true;
+    for (U32 lo, hi; par_take(w, lo, hi); ) {
+        for (U32 i = lo; i < hi; i++) { PUSH(i); CALL(par.xt); }
+    }
+    par_worker = false;
+}
+void par_loop(int w) {                      /** thread body of pool worker w */
+    fout_cb = [](int, const char *s) { Serial.print(s); };
+    U32 gen = 0;
+    for (;;) {
+        {
+            unique_lock<mutex> lk(par_mtx);
+            par_go.wait(lk, [&gen]{ return par.gen != gen; });
+            gen = par.gen;
+            if (w >= par.nw) continue;      /// * not in this job
+        }
+        vm_reset();
+        dict.idx = par.didx; pmem.idx = par.here;
+        ovl_id = par.oid; ovl_dlo = par.dlo; ovl_plo = par.plo; ovl_base = par.base; ovl_np = par.np;
+        par_work(w);
+        fout_flush(true);
+        lock_guard<mutex> lk(par_mtx);
+        if (--par.busy == 0) par_done.notify_all();
+    }
+}
+void par_for(DU n, IU xt) {
+    int nw = par_nw ? par_nw : (int)thread::hardware_concurrency();
+    nw = MULTI_VM ? max(1, min(nw, PAR_MAX)) : 1;   /// * shared VM state, serial
+    if (n <= 0) return;
+    unique_lock<mutex> job(par_job, defer_lock);
+    if (par_worker) nw = 1;                 /// * nested, leave par alone
+    else if (!job.try_lock()) nw = 1;       /// * another VM's job, leave par alone
+    else if (nw == 1 || n < 2 * PAR_GRAIN) { nw = 1; par.nw = 1; par.steals = 0; }
+    if (nw == 1) {
+        if (job.owns_lock()) job.unlock();
+        for (DU i = 0; i < n; i++) { PUSH(i); CALL(xt); }
+        return;
+    }
+    thread_cfg();
+    for (; par_pool < nw - 1; par_pool++) thread(par_loop, par_pool + 1).detach();
+    unique_lock<mutex> lk(par_mtx);
+    par.xt = xt; par.nw = nw; par.busy = nw - 1; par.steals = 0;
+    par.didx = dict.idx; par.here = HERE;
+    par.oid = ovl_id; par.dlo = ovl_dlo; par.plo = ovl_plo; par.base = ovl_base; par.np = ovl_np;
+    for (int w = 0; w < nw; w++) {
+        U32 lo = (uint64_t)n * w / nw, hi = (uint64_t)n * (w + 1) / nw;
+        par.rng[w] = (uint64_t)hi << 32 | lo;
+    }
+    par.gen++;
+    par_go.notify_all();
+    lk.unlock();
+    par_work(0);                            /// * the caller takes its share too
+    lk.lock();
+    par_done.wait(lk, []{ return par.busy == 0; });
+}
+///================================================================================
+///
+/// deferred interrupts
+/// Note:
+///   * an ISR only stamps an event (src, time, value) into ev_q, the VM drains
+///     ev_q at safe points (end of nest, task_idle) and calls the
+///     handler word of the source as ( ts value -- )
+///   * ev_q is bounded and lock-free, many producers (nested ISRs) and one
+///     consumer, an event that finds it full is dropped and counted
+///   * the consumer is whichever VM wins ev_busy, the others go on, so a
+///     handler runs on one VM at a time and never recurses into ev_drain
+///   * src 0..39 are GPIO pins, EV_TIMER is hardware timer 0
+///
+#define EV_Q      64                        /** queue depth, power of 2 */
+#define EV_SRC    41
+#define EV_TIMER  40
+struct Event { U32 ts; DU val; U8 src; };
+struct EvQ {
+    Event       v[EV_Q];
+    atomic<U32> seq[EV_Q];                  /// slot p is full when seq == p+1
+    atomic<U32> head{0};
+    U32         tail = 0;                   /// consumer only
+    EvQ() { for (U32 i = 0; i < EV_Q; i++) seq[i] = i; }
+    bool put(const Event &e) {
+        U32 p = head.load(memory_order_relaxed);
+        for (;;) {
+            int d = (int)(seq[p & (EV_Q - 1)].load(memory_order_acquire) - p);
+            if (d < 0) return false;
+            if (d > 0) p = head.load(memory_order_relaxed);
+            else if (head.compare_exchange_weak(p, p + 1, memory_order_relaxed)) break;
+        }
+        v[p & (EV_Q - 1)] = e;
+        seq[p & (EV_Q - 1)].store(p + 1, memory_order_release);
+        return true;
+    }
+    bool get(Event &e) {
+        U32 p = tail;
+        if (seq[p & (EV_Q - 1)].load(memory_order_acquire) != p + 1) return false;
+        e = v[p & (EV_Q - 1)];
+        seq[p & (EV_Q - 1)].store(p + EV_Q, memory_order_release);
+        tail = p + 1;
+        return true;
+    }
+};
+EvQ           ev_q;
+IU            ev_xt[EV_SRC];                /// handler word per source, 0 = none
+volatile bool ev_flag = false;              /// raised by ISRs, cleared by ev_drain
+atomic<U32>   ev_drop{0};                   /// events lost to a full queue
+volatile U32  ev_isr_max = 0;               /// longest ISR, in us
+U32           ev_lat_max = 0;               /// longest ISR to handler delay, in us
+atomic<bool>  ev_busy{false};               /// a VM is draining ev_q
+hw_timer_t    *ev_timer = NULL;
+
+void IRAM_ATTR ev_isr(U8 src, DU val) {     /** common body of all ISRs */
+    U32 t0 = micros();
+    if (!ev_q.put({ t0, val, src })) ev_drop++;
+    ev_flag = true;
+    U32 dt = micros() - t0;
+    if (dt > ev_isr_max) ev_isr_max = dt;
+}
+void IRAM_ATTR ev_gpio_isr(void *arg) {
+    int pin = (int)(intptr_t)arg;
+    ev_isr(pin, digitalRead(pin));
+}
+void IRAM_ATTR ev_timer_isr() { ev_isr(EV_TIMER, 0); }
+void ev_drain() {
+    if (par_worker) return;                 /// * wait for the par-for join
+    if (ev_busy.exchange(true, memory_order_acquire)) return;
+    ev_flag = false;
+    for (Event e; ev_q.get(e); ) {
+        U32 lat = (U32)micros() - e.ts;
+        if (lat > ev_lat_max) ev_lat_max = lat;
+        IU xt = ev_xt[e.src];
+        if (!xt) continue;
+        PUSH(e.ts); PUSH(e.val);
+        CALL(xt);
+    }
+    ev_busy.store(false, memory_order_release);
+}
+void ev_timer_set(U32 us) {                 /** 0 stops the timer */
+    if (!ev_timer) {
+        ev_timer = timerBegin(0, 80, true); /// 1us tick from 80MHz APB
+        timerAttachInterrupt(ev_timer, ev_timer_isr, true);
+    }
+    if (!us) { timerAlarmDisable(ev_timer); return; }
+    timerAlarmWrite(ev_timer, us, true);
+    timerAlarmEnable(ev_timer);
+}
 ///================================================================================
 ///
 /// primitives (ROMable)
@@ -340,54 +1741,101 @@ inline DU   POP()         { DU n = top; top=ss.pop(); return n; }
 ///   * it can be stored in ROM, and only
 ///   * find() needs to be modified to support ROM+RAM
 ///
+int tokenize_file(const char *src, const char *dst);  /// see forth_load
 static Code prim[] PROGMEM = {
     ///
     /// @defgroup Executino control ops
     /// @brief - do not change order, see forth_opcode enum sequence
     /// @{
     CODE("nop",     {}),
-    CODE("dovar",   PUSH(IPOFF); IP += sizeof(DU)),
-    CODE("dolit",   PUSH(*(DU*)IP); IP += sizeof(DU)),
+    CODE("dovar",   IP = CELLP(IP); PUSH(ovl_va(IPOFF)); IP += sizeof(DU)),
+    CODE("dolit",   IP = CELLP(IP); PUSH(*(DU*)IP); IP += sizeof(DU)),
     CODE("dostr",
          const char *s = (const char*)IP;            // get string pointer
          PUSH(IPOFF); IP += STRLEN(s)),
     CODE("dotstr",
          const char *s = (const char*)IP;            // get string pointer
          fout << s;  IP += STRLEN(s)),               // send to output console
-    CODE("branch" , IP = JMPIP),                         // unconditional branch
-    CODE("0branch", IP = POP() ? IP+sizeof(IU) : JMPIP), // conditional branch
+    CODE("branch" ,                                  // unconditional branch
+         U8 *t = JMPIP; if (t < IP) BUDGET(); IP = t),
+    CODE("0branch",                                  // conditional branch
+         if (POP()) { IP += sizeof(IU); return; }
+         U8 *t = JMPIP; if (t < IP) BUDGET(); IP = t),
     CODE("donext",
-         if ((rs[-1] -= 1) >= 0) IP = JMPIP;         // rs[-1]-=1 saved 2000ms/1M cycles
+         if ((rs.top(1) -= 1) >= 0) { IP = JMPIP; BUDGET(); } // rs[-1]-=1 saved 2000ms/1M cycles
          else { IP += sizeof(IU); rs.pop(); }),
     CODE("does",                                     // CREATE...DOES... meta-program
          U8 *ip  = PFA(WP);
          U8 *ipx = ip + PFLEN(WP);                   // range check
          while (ip < ipx && *(IU*)ip != DOES) ip+=sizeof(IU);  // find DOES
-         while ((ip += sizeof(IU)) < ipx) add_iu(*(IU*)ip);    // copy&paste code
+         while ((ip += sizeof(IU)) < ipx) {                    // copy&paste code
+             IU c = *(IU*)ip; add_iu(c);
+             if (c != DOVAR && c != DOLIT && c != DOFLIT) continue;
+             ip = CELLP(ip + sizeof(IU)); add_du(*(DU*)ip);    // realign cell operand
+             ip += sizeof(DU) - sizeof(IU);
+         }
          IP = ipx),                                            // done
     CODE(">r",   rs.push(POP())),
+    CODE("doflit", IP = CELLP(IP); fss.push(*(DF*)IP); IP += sizeof(DF)),
     CODE("r>",   PUSH(rs.pop())),
-    CODE("r@",   PUSH(rs[-1])),
+    CODE("r@",   PUSH(rs.top(1))),
     /// @}
     /// @defgroup Stack ops
     /// @brief - from here on, opcode sequence can be freely reordered
     /// @{
     CODE("dup",  PUSH(top)),
     CODE("drop", top = ss.pop()),
-    CODE("over", PUSH(ss[-1])),
+    CODE("over", PUSH(ss.top(1))),
     CODE("swap", DU n = ss.pop(); PUSH(n)),
     CODE("rot",  DU n = ss.pop(); DU m = ss.pop(); ss.push(n); PUSH(m)),
-    CODE("pick", DU i = top; top = ss[-i]),
+    CODE("pick", DU i = top; top = ss.top(i)),
     /// @}
     /// @defgroup Stack ops - double
     /// @{
-    CODE("2dup", PUSH(ss[-1]); PUSH(ss[-1])),
+    CODE("2dup", PUSH(ss.top(1)); PUSH(ss.top(1))),
     CODE("2drop",ss.pop(); top = ss.pop()),
-    CODE("2over",PUSH(ss[-3]); PUSH(ss[-3])),
+    CODE("2over",PUSH(ss.top(3)); PUSH(ss.top(3))),
     CODE("2swap",
          DU n = ss.pop(); DU m = ss.pop(); DU l = ss.pop();
          ss.push(n); PUSH(l); PUSH(m)),
     /// @}
+    /// @defgroup Double ops
+    /// @brief - ( lo hi ) pairs computed natively in DU2
+    /// @{
+    CODE("s>d",     PUSH(top < 0 ? -1 : 0)),
+    CODE("d>s",     POP()),
+    CODE("d+",      DU2 d = DPOP(); DPUSH(DPOP() + d)),
+    CODE("d-",      DU2 d = DPOP(); DPUSH(DPOP() - d)),
+    CODE("m+",      DU  n = POP();  DPUSH(DPOP() + n)),
+    CODE("dnegate", DPUSH(-DPOP())),
+    CODE("dabs",    DU2 d = DPOP(); DPUSH(d < 0 ? -d : d)),
+    CODE("d2*",     DPUSH(DPOP() * 2)),
+    CODE("d2/",     DPUSH(DPOP() >> 1)),
+    CODE("dmax",    DU2 d = DPOP(); DU2 e = DPOP(); DPUSH(d > e ? d : e)),
+    CODE("dmin",    DU2 d = DPOP(); DU2 e = DPOP(); DPUSH(d < e ? d : e)),
+    CODE("d=",      DU2 d = DPOP(); DU2 e = DPOP(); PUSH(BOOL(e == d))),
+    CODE("d<",      DU2 d = DPOP(); DU2 e = DPOP(); PUSH(BOOL(e <  d))),
+    CODE("d0=",     DU2 d = DPOP(); PUSH(BOOL(d == 0))),
+    CODE("d0<",     DU2 d = DPOP(); PUSH(BOOL(d <  0))),
+    CODE("m*",      DU2 d = (DU2)ss.pop() * top; top = (DU)d; PUSH(dhi(d))),
+    CODE("um*",                                      // u1 u2 -- ud
+         uint64_t d = (uint64_t)(UDU)ss.pop() * (UDU)top;
+         top = (DU)d; PUSH(dhi((DU2)d))),
+    CODE("um/mod",                                   // ud u -- urem uquot
+         UDU u = (UDU)POP(); uint64_t d = (uint64_t)DPOP();
+         PUSH((DU)(d % u)); PUSH((DU)(d / u))),
+    CODE("sm/rem",                                   // d n -- rem quot, symmetric
+         DU n = POP(); DU2 d = DPOP();
+         PUSH((DU)(d % n)); PUSH((DU)(d / n))),
+    CODE("fm/mod",                                   // d n -- rem quot, floored
+         DU n = POP(); DU2 d = DPOP();
+         DU2 q = d / n; DU2 r = d % n;
+         if (r != 0 && ((r < 0) != (n < 0))) { q--; r += n; }
+         PUSH((DU)r); PUSH((DU)q)),
+    CODE("d.",      fout << DPOP() << " "),
+    CODE("2@",      IU w = POP(); PUSH(CELL(w + sizeof(DU))); PUSH(CELL(w))), // w -- lo hi
+    CODE("2!",      IU w = POP(); CELL(w) = POP(); CELL(w + sizeof(DU)) = POP()),
+    /// @}
     /// @defgroup ALU ops
     /// @{
     CODE("+",    top += ss.pop()),
@@ -395,14 +1843,14 @@ static Code prim[] PROGMEM = {
     CODE("-",    top =  ss.pop() - top),
     CODE("/",    top =  ss.pop() / top),
     CODE("mod",  top =  ss.pop() % top),
-    CODE("*/",   top =  ss.pop() * ss.pop() / top),
+    CODE("*/",   top =  (DU)((DU2)ss.pop() * ss.pop() / top)),
     CODE("/mod",
          DU n = ss.pop(); DU t = top;
          ss.push(n % t); top = (n / t)),
     CODE("*/mod",
-         DU n = ss.pop() * ss.pop();
-         DU t = top;
-         ss.push(n % t); top = (n / t)),
+         DU2 n = (DU2)ss.pop() * ss.pop();
+         DU  t = top;
+         ss.push((DU)(n % t)); top = (DU)(n / t)),
     CODE("and",  top = ss.pop() & top),
     CODE("or",   top = ss.pop() | top),
     CODE("xor",  top = ss.pop() ^ top),
@@ -427,6 +1875,45 @@ static Code prim[] PROGMEM = {
     CODE(">=",   top = BOOL(ss.pop() >= top)),
     CODE("<=",   top = BOOL(ss.pop() <= top)),
     /// @}
+    /// @defgroup Float ops
+    /// @brief - on float stack fss, DF is cell-sized so f@ f! use pmem cells
+    /// @{
+    CODE("fdup",    fss.push(fss.top(1))),
+    CODE("fdrop",   fss.pop()),
+    CODE("fswap",   DF r = fss.pop(); DF q = fss.pop(); fss.push(r); fss.push(q)),
+    CODE("fover",   fss.push(fss.top(2))),
+    CODE("f+",      DF r = fss.pop(); fss.top(1) += r),
+    CODE("f-",      DF r = fss.pop(); fss.top(1) -= r),
+    CODE("f*",      DF r = fss.pop(); fss.top(1) *= r),
+    CODE("f/",      DF r = fss.pop(); fss.top(1) /= r),
+    CODE("fnegate", fss.top(1) = -fss.top(1)),
+    CODE("fabs",    fss.top(1) = fabs(fss.top(1))),
+    CODE("fsqrt",   fss.top(1) = sqrt(fss.top(1))),
+    CODE("fsin",    fss.top(1) = sin(fss.top(1))),
+    CODE("fcos",    fss.top(1) = cos(fss.top(1))),
+    CODE("fatan2",  DF x = fss.pop(); fss.top(1) = atan2(fss.top(1), x)), // F: y x -- r
+    CODE("f<",      DF r = fss.pop(); PUSH(BOOL(fss.pop() < r))),
+    CODE("f0<",     PUSH(BOOL(fss.pop() < 0))),
+    CODE("s>f",     fss.push((DF)POP())),
+    CODE("f>s",     PUSH((DU)fss.pop())),
+    CODE("f@",      IU w = POP(); fss.push(*(DF*)&pmem[ovl_va(w, sizeof(DF))])), // w -- F: -- r
+    CODE("f!",      IU w = POP(); *(DF*)&pmem[ovl_va(w, sizeof(DF))] = fss.pop()), // w -- F: r --
+    IMMD("fliteral",add_iu(DOFLIT); add_df(fss.pop())),                 // F: r --
+    CODE("f.",      fout << fss.pop() << " "),
+    /// @}
+    /// @defgroup Fixed-point ops
+    /// @brief - Q16.16 in a cell, literal 1.25 is a fixed-point number
+    /// @{
+    CODE("q*",      top = qmul(ss.pop(), top)),
+    CODE("q/",      top = qdiv(ss.pop(), top)),
+    CODE("qsqrt",   top = qsqrt(top)),
+    CODE("qsin",    top = qsin(top)),
+    CODE("qcos",    top = qcos(top)),
+    CODE("qlerp",                                    // a b t -- a+(b-a)*t
+         DU t = top; DU b = ss.pop(); DU a = ss.pop();
+         top = qsat(a + ((((DU2)b - a) * t) >> FIXQ))),
+    CODE("q.",      fout << (double)POP() / (1 << FIXQ) << " "),
+    /// @}
     /// @defgroup IO ops
     /// @{
     CODE("base@",   PUSH(base)),
@@ -438,14 +1925,14 @@ static Code prim[] PROGMEM = {
     CODE(".r",      DU n = POP(); dot_r(n, POP())),
     CODE("u.r",     DU n = POP(); dot_r(n, abs(POP()))),
     CODE(".f",      DU n = POP(); fout << setprecision(n) << POP()),
-    CODE("key",     PUSH(next_word()[0])),
+    CODE("key",     char *s = next_word(); PUSH(*s ? (DU)*s : vm_key())),
     CODE("emit",    char b = (char)POP(); fout << b),
     CODE("space",   fout << " "),
     CODE("spaces",  for (DU n = POP(), i = 0; i < n; i++) fout << " "),
     /// @}
     /// @defgroup Literal ops
     /// @{
-    CODE("[",       compile = false),
+    IMMD("[",       compile = false),
     CODE("]",       compile = true),
     IMMD("(",       scan(')')),
     IMMD(".(",      fout << scan(')')),
@@ -489,8 +1976,8 @@ static Code prim[] PROGMEM = {
     /// @}
     /// @defgrouop Compiler ops
     /// @{
-    CODE(":", colon(next_word()); compile=true),
-    IMMD(";", compile = false),
+    CODE(":", txn_begin(); colon(next_word()); compile=true),
+    IMMD(";", compile = false; txn_commit()),
     CODE("create",
          colon(next_word());                                 // create a new word on dictionary
          add_iu(DOVAR)),                                     // dovar (+parameter field) 
@@ -514,22 +2001,212 @@ static Code prim[] PROGMEM = {
     CODE("+!",    IU w = POP(); CELL(w) += POP()),           // n w --
     CODE("?",     IU w = POP(); fout << CELL(w) << " "),     // w --
     /// @}
+    /// @defgroup Byte and block memory ops
+    /// @brief - bulk moves go through memmove/memset, i.e. word-at-a-time
+    /// @{
+    CODE("c@",    U8 *p = pmem_blk(top, 1); top = p ? *p : 0),        // a -- c
+    CODE("c!",    U8 *p = pmem_blk(POP(), 1); DU c = POP(); if (p) *p = (U8)c),
+    CODE("w@",    U8 *p = pmem_blk(top, 2); U16 v = 0;                // a -- w
+         if (p) memcpy(&v, p, 2); top = v),
+    CODE("w!",    U8 *p = pmem_blk(POP(), 2); U16 v = (U16)POP();     // w a --
+         if (p) memcpy(p, &v, 2)),
+    CODE("move",                                                      // a1 a2 u --
+         DU n = POP(); U8 *d = pmem_blk(POP(), n); U8 *s = pmem_blk(POP(), n);
+         if (d && s) memmove(d, s, n)),
+    CODE("cmove",                                                     // a1 a2 u --
+         DU n = POP(); U8 *d = pmem_blk(POP(), n); U8 *s = pmem_blk(POP(), n);
+         if (!d || !s) return;
+         if (d <= s || d >= s + n) memmove(d, s, n);                  // no forward overlap
+         else for (DU i = 0; i < n; i++) d[i] = s[i]),                // replicate pattern
+    CODE("cmove>",                                                    // a1 a2 u --
+         DU n = POP(); U8 *d = pmem_blk(POP(), n); U8 *s = pmem_blk(POP(), n);
+         if (!d || !s) return;
+         if (d >= s || d + n <= s) memmove(d, s, n);                  // no backward overlap
+         else for (DU i = n - 1; i >= 0; i--) d[i] = s[i]),
+    CODE("fill",                                                      // a u c --
+         DU c = POP(); DU n = POP(); U8 *p = pmem_blk(POP(), n);
+         if (p) memset(p, (U8)c, n)),
+    CODE("erase",                                                     // a u --
+         DU n = POP(); U8 *p = pmem_blk(POP(), n); if (p) memset(p, 0, n)),
+    CODE("compare",                                                   // a1 u1 a2 u2 -- n
+         DU n2 = POP(); U8 *p2 = pmem_blk(POP(), n2);
+         DU n1 = POP(); U8 *p1 = pmem_blk(top, n1);
+         if (!p1 || !p2) { top = 0; return; }
+         int r = memcmp(p1, p2, n1 < n2 ? n1 : n2);
+         top = r < 0 ? -1 : r > 0 ? 1 : BOOL(n1 < n2) + (n1 > n2)),
+    /// @}
+    /// @defgroup Cell-array ops
+    /// @brief - one dispatch per array instead of per element
+    /// @{
+    CODE("a-sum",    DU n = POP(); DU *a = ARY(top, n); top = a ? a_sum(a, n) : 0), // a n -- s
+    CODE("a-dot",                                                     // a1 a2 n -- s
+         DU n = POP(); DU *b = ARY(POP(), n); DU *a = ARY(top, n);
+         top = a && b ? a_dot(a, b, n) : 0),
+    CODE("a-scale",  DU k = POP(); DU n = POP(); DU *a = ARY(POP(), n); // a n k --
+         if (a) a_scale(a, n, k)),
+    CODE("a-add",                                                     // a1 a2 a3 n --
+         DU n = POP(); DU *c = ARY(POP(), n); DU *b = ARY(POP(), n); DU *a = ARY(POP(), n);
+         if (a && b && c) a_add(a, b, c, n)),
+    CODE("a-minmax",                                                  // a n -- min max
+         DU n = POP(); DU *a = ARY(top, n); DU lo = 0; DU hi = 0;
+         if (a && n > 0) a_minmax(a, n, &lo, &hi);
+         top = lo; PUSH(hi)),
+    CODE("a-clamp",                                                   // a n lo hi --
+         DU hi = POP(); DU lo = POP(); DU n = POP(); DU *a = ARY(POP(), n);
+         if (a) a_clamp(a, n, lo, hi)),
+    CODE("a-fill",   DU v = POP(); DU n = POP(); DU *a = ARY(POP(), n); // a n v --
+         if (a) a_fill(a, n, v)),
+    CODE("sort",     DU n = POP(); DU *a = ARY(POP(), n);             // a n --
+         if (a) a_sort(a, n, LtNum())),
+    CODE("sort-by",                                                   // a n xt --
+         LtXt lt = { (IU)POP() }; DU n = POP(); DU *a = ARY(POP(), n);
+         if (a) a_sort(a, n, lt)),
+    CODE("bsearch",                                                   // a n x -- i|-1
+         DU x = POP(); DU n = POP(); DU *a = ARY(top, n);
+         int i = a ? a_lbound(a, n, x) : n;
+         top = (i < n && a[i] == x) ? i : -1),
+    CODE("rmedian",                                                   // x s w -- m
+         DU w = POP(); DU p = POP();
+         DU *s = (w > 0 && w < PMEM_SZ) ? ARY(p, 2 * w + 2) : NULL;
+         if (s) top = a_rmedian(s, w, top)),
+    /// @}
+    /// @defgroup Hash map ops
+    /// @brief - m is a map handle, k a cell or a string key for map-new$ maps
+    /// @{
+    CODE("map-new",  PUSH(map_new(false))),                           // -- m
+    CODE("map-new$", PUSH(map_new(true))),                            // -- m
+    CODE("map-free", Map *m = map_at(POP()); if (m) map_free(*m)),    // m --
+    CODE("map-put",                                                   // v k m --
+         Map *m = map_at(POP()); DU k = POP(); DU v = POP();
+         if (!m || !map_key(*m, k)) return;
+         if (m->busy) { fout << "ERR: map busy" << ENDL; return; }
+         map_put(*m, k, v)),
+    CODE("map-get",                                                   // k m -- v f
+         Map *m = map_at(POP());
+         MapSlot *s = m && map_key(*m, top) ? map_get(*m, top) : NULL;
+         top = s ? s->val : 0; PUSH(BOOL(s))),
+    CODE("map-del",                                                   // k m -- f
+         Map *m = map_at(POP());
+         if (m && m->busy) { fout << "ERR: map busy" << ENDL; m = NULL; }
+         top = BOOL(m && map_key(*m, top) && map_del(*m, top))),
+    CODE("map-each",                                                  // xt m --
+         Map *m = map_at(POP()); IU xt = POP();
+         if (m && !m->busy) map_each(*m, xt)),
+    /// @}
+    /// @defgroup Multitasking ops
+    /// @brief - cooperative, switches at pause, stop, sleep-ms, delay and a waiting channel
+    /// @{
+    CODE("task",     PUSH(task_new())),                               // -- t
+    CODE("activate", DU t = POP(); task_activate(POP(), t)),          // xt t --
+    CODE("pause",    task_switch()),
+    CODE("stop",     task_stop()),
+    CODE("wake",     task_wake(POP())),                               // t --
+    CODE("sleep-ms", task_sleep(POP())),                              // ms --
+    CODE("slice",    DU n = POP(); slice = budget = n < 1 ? 1 : n),   // n --
+    /// @}
+    /// @defgroup Channel ops
+    /// @brief - ch is 1..CHAN_MAX, ? does not wait, -ms waits up to ms
+    /// @{
+    CODE("chan-new",    top = chan_new(top, false)),                  // n -- ch
+    CODE("chan-new-mp", top = chan_new(top, true)),                   // n -- ch
+    CODE("chan-free",   Chan *c = chan_at(POP()); if (c) chan_free(*c)), // ch --
+    CODE("chan-send",                                                 // v ch --
+         if (!task_block(chan_ready(top, true), NULL)) {
+             DU h = POP(); chan_send(h, POP(), -1);
+         }),
+    CODE("chan-send?",  DU h = POP(); top = BOOL(chan_send(h, top, 0))), // v ch -- f
+    CODE("chan-send-ms",                                              // v ch ms -- f
+         if (!task_block(chan_ready(ss.top(1), true), &top)) {
+             DU ms = POP(); DU h = POP(); top = BOOL(chan_send(h, top, ms));
+         }),
+    CODE("chan-recv",                                                 // ch -- v
+         if (!task_block(chan_ready(top, false), NULL)) chan_recv(top, top, -1)),
+    CODE("chan-recv?",                                                // ch -- v f
+         DU v; bool ok = chan_recv(top, v, 0); top = v; PUSH(BOOL(ok))),
+    CODE("chan-recv-ms",                                              // ch ms -- v f
+         if (!task_block(chan_ready(ss.top(1), false), &top)) {
+             DU ms = POP(); DU v; bool ok = chan_recv(top, v, ms);
+             top = v; PUSH(BOOL(ok));
+         }),
+    CODE("chan-select",                                               // ch1 .. chn n ms -- v ch
+         if (!task_block(chan_ready_n(ss.top(1)), &top)) {
+             DU ms = POP(); int n = POP(); DU v; DU h = chan_select(n, ms, v);
+             PUSH(v); PUSH(h);
+         }),
+    /// @}
+    /// @defgroup Parallel ops
+    /// @brief - xt ( i -- ) runs on every core, see par_for
+    /// @{
+    CODE("par-for",     IU xt = POP(); par_for(POP(), xt)),           // n xt --
+    CODE("par-workers",                                               // n --
+         DU n = POP(); par_nw = n < 0 ? 0 : min((int)n, PAR_MAX)),
+    CODE("par-stat",    PUSH(par.nw); PUSH(par.steals.load())),       // -- workers steals
+    /// @}
+    /// @defgroup Coroutine ops
+    /// @brief - co is 1..CO_MAX, see co_resume
+    /// @{
+    CODE("coroutine",   top = co_new(top)),                           // xt -- co
+    CODE("resume",                                                    // x co -- y f
+         Co *c = co_at(POP()); DU x = POP();
+         bool ok = c && co_resume(*c, x);
+         if (!c) x = 0;
+         PUSH(x); PUSH(BOOL(ok))),
+    CODE("yield-co",    co_yield()),                                  // y -- x
+    CODE("co-free",     Co *c = co_at(POP()); if (c) co_free(*c)),  // co --
+    /// @}
+    /// @defgroup Periodic ops
+    /// @brief - id is 1..SCHED_MAX, stats are in microseconds
+    /// @{
+    CODE("every",                                                     // ms xt -- id
+         IU xt = POP(); top = sched_add((U32)top * 1000, xt);
+         if (!top) fout << "ERR: too many timers" << ENDL),
+    CODE("every-us",                                                  // us xt -- id
+         IU xt = POP(); top = sched_add((U32)top, xt);
+         if (!top) fout << "ERR: too many timers" << ENDL),
+    CODE("every-stop",                                                // id --
+         sched_stop(POP())),
+    CODE("every-stat",                                                // id -- runs over min max mean
+         lock_guard<recursive_mutex> lk(sched_mtx);
+         Timer *t = sched_at(top);
+         if (!t) { top = 0; PUSH(0); PUSH(0); PUSH(0); PUSH(0); return; }
+         top = t->runs; PUSH(t->over);
+         PUSH(t->runs ? t->jmin : 0); PUSH(t->jmax);
+         PUSH(t->runs ? (DU)(t->jsum / t->runs) : 0)),
+    /// @}
+    /// @defgroup Interrupt ops
+    /// @brief - handlers are ( ts value -- ), run by the VM, not in the ISR
+    /// @{
+    CODE("irq",                                                       // pin mode xt --
+         IU xt = POP(); DU mode = POP(); DU pin = POP();
+         if (pin < 0 || pin >= EV_TIMER) { fout << "ERR: bad pin" << ENDL; return; }
+         ev_xt[pin] = xt;
+         attachInterruptArg(pin, ev_gpio_isr, (void*)(intptr_t)pin, mode)),
+    CODE("irq-off",                                                   // pin --
+         DU pin = POP();
+         if (pin >= 0 && pin < EV_TIMER) { detachInterrupt(pin); ev_xt[pin] = 0; }),
+    CODE("timer-irq",                                                 // us xt --
+         ev_xt[EV_TIMER] = POP(); ev_timer_set(POP())),
+    CODE("irq-stat",                                                  // -- isr lat drop
+         PUSH(ev_isr_max); PUSH(ev_lat_max); PUSH(ev_drop.load())),
+    /// @}
     /// @defgroup metacompiler
     /// @{
     CODE("exit",  IP = PFA(WP) + PFLEN(WP)),                 // quit current word execution
-    CODE("exec",  CALL(POP())),                              // execute word
+    CODE("exec",  IU w = POP(); CALL(w)),                    // execute word
     CODE("create",
         colon(next_word());                                  // create a new word on dictionary
         add_iu(DOVAR)),                                      // dovar (+ parameter field)
     CODE("to",              // 3 to x                        // alter the value of a constant
-    	IU w = find(next_word());                            // to save the extra @ of a variable
-	    *(DU*)(PFA(w) + sizeof(IU)) = POP()),
+    	IU w = find(next_word()); ovl_body(w);               // to save the extra @ of a variable
+	    *(DU*)CELLP(PFA(w) + sizeof(IU)) = POP()),
 	CODE("is",              // ' y is x                      // alias a word
 		IU w = find(next_word());                            // can serve as a function pointer
-        dict[POP()].pfa = dict[w].pfa),                      // but might leave a dangled block
+        IU x = POP(); OvlPat *p = ovl_own(x);                // a base word, for this overlay
+        if (p) { p->pfa = ovl_pfa(w); p->len = ovl_len(w); p->cow = false; }
+        else dict[x].pfa = dict[w].pfa),                     // but might leave a dangled block
     CODE("[to]",            // : xx 3 [to] y ;               // alter constant in compile mode
-        IU w = *(IU*)IP; IP += sizeof(IU);                   // fetch constant pfa from 'here'
-	    *(DU*)(PFA(w) + sizeof(IU)) = POP()),
+        IU w = *(IU*)IP; IP += sizeof(IU); ovl_body(w);      // fetch constant pfa from 'here'
+	    *(DU*)CELLP(PFA(w) + sizeof(IU)) = POP()),
     /// @}
     /// @defgroup Debug ops
     /// @{
@@ -546,9 +2223,10 @@ static Code prim[] PROGMEM = {
          IU w = find(next_word());
          if (w<0) return;
          IU b = find("boot")+1;
+         if (b < ovl_dlo) b = ovl_dlo;                       // base words stay
          dict.clear(w > b ? w : b)),
     CODE("clock", PUSH(millis())),
-    CODE("delay", delay(POP())),
+    CODE("delay", task_sleep(POP())),
     /// @}
     /// @defgroup Arduino specific ops
     /// @{
@@ -561,56 +2239,212 @@ static Code prim[] PROGMEM = {
     CODE("setup", DU ch = POP(); DU freq=POP(); ledcSetup(ch, freq, POP())),
     CODE("tone",  DU ch = POP(); ledcWriteTone(ch, POP())),
     /// @}
+    CODE("tokenize-file",                     /// tokenize-file /load.txt /load.tok
+         string src = next_word();
+         tokenize_file(src.c_str(), next_word())),
     CODE("bye",   exit(0)),                   /// soft reboot ESP32
-    CODE("boot",  dict.clear(find("boot") + 1); pmem.clear())
+    CODE("freeze",
+         if (!ovl_freeze()) fout << "ERR: cannot freeze" << ENDL),
+    CODE("boot",
+         if (ovl_id < 0) { dict.clear(find("boot") + 1); pmem.clear(); }
+         else            ovl_reset())
 };
 const int PSZ = sizeof(prim)/sizeof(Code);
 ///
 /// dictionary initialization
 ///
+void vm_reset() {                            /// registers of the calling VM only
+    ss.clear(); rs.clear(); fss.clear();
+    top = -1; base = 10; ucase = 1; compile = false;
+    WP = 0; IP = IP0 = PMEM0;
+}
+bool dict_ok = false;                        /// dictionary built, see ForthVM
 void forth_init() {
+    dict_ok = true;
     for (int i=0; i<PSZ; i++) {              /// copy prim(ROM) into RAM dictionary,
         dict.push(prim[i]);                  /// find() can be modified to support
     }                                        /// searching both spaces
+    vm_reset();
+}
+///
+/// number parser - single pass over (s, len), no strtol
+/// Note:
+///   * prefixes: $ff hex, #99 decimal, %101 binary, 'c' character
+///   * 123. is a double (lo hi on stack), 1.25 is fixed-point (FIXQ fraction bits)
+///   * B is the base known at compile-time (10, 16), B=0 for any other base
+///
+enum { NUM_NA = 0, NUM_SINGLE, NUM_DOUBLE, NUM_FLOAT };
+int scan_exp(const char *p, const char *e, uint64_t v, DU2 f, DU2 fs, DU2 *n) {
+    bool neg = p < e && *p == '-';          /// exponent of a float, 1.5e-3
+    if (p < e && (*p == '-' || *p == '+')) p++;
+    int x = 0;
+    for (; p < e; p++) {
+        if ((U8)(*p - '0') > 9) return NUM_NA;
+        if (x < 10000) x = x * 10 + (*p - '0');    /// * pow() gives inf or 0 anyway
+    }
+    DF r = (DF)(((double)v + (double)f / fs) * pow(10.0, neg ? -x : x));
+    *n = 0; memcpy(n, &r, sizeof(DF));      /// float bits in the low cell
+    return NUM_FLOAT;
+}
+template<int B>
+int scan_num(const char *p, const char *e, int b, DU2 *n) {
+    uint64_t v = 0;                         /// integer, unsigned so overflow is defined
+    DU2  f = 0, fs = 1;                     /// fraction, fraction scale
+    bool dot = false;
+    const char *p0 = p;
+    for (; p < e; p++) {
+        char c = *p;
+        int  d;
+        if (B == 10)      d = (U8)(c - '0') < 10 ? c - '0' : -1;
+        else if (B == 16) d = (U8)(c - '0') < 10 ? c - '0'
+                            : (U8)((c | 0x20) - 'a') < 6 ? (c | 0x20) - 'a' + 10 : -1;
+        else {
+            d = (U8)(c - '0') < 10 ? c - '0'
+              : (U8)((c | 0x20) - 'a') < 26 ? (c | 0x20) - 'a' + 10 : -1;
+            if (d >= b) d = -1;
+        }
+        if (d < 0) {
+            if (B == 10 && (c | 0x20) == 'e' && p > p0 + dot)
+                return scan_exp(p + 1, e, v, f, fs, n);  /// * float, decimal only
+            if (c != '.' || dot) return NUM_NA;  /// * one decimal point only
+            dot = true; continue;
+        }
+        if (!dot) {
+            uint64_t r = B ? B : b;
+            if (v > (~(uint64_t)0 - d) / r) return NUM_NA;   /// * overflow
+            v = v * r + d;
+        }
+        else if (fs < (1<<24)) { f = B ? f * B + d : f * b + d; fs *= B ? B : b; }
+    }
+    if (!dot) {                                  /// * must fit a cell, 0xFFFFFFFF too
+        if (v > (UDU)~0) return NUM_NA;
+        *n = (DU2)v; return NUM_SINGLE;
+    }
+    if (fs == 1) { *n = (DU2)v; return NUM_DOUBLE; }  /// * trailing '.', double cell
+    if (v > ((UDU)~0 >> FIXQ)) return NUM_NA;
+    *n = (DU2)((v << FIXQ) + (f << FIXQ) / fs);  /// * fixed-point
+    return NUM_SINGLE;
+}
+int number(const char *s, int len, DU2 *n) {
+    const char *p = s, *e = s + len;
+    int  b   = base;
+    bool neg = false;
+    if (p < e && *p == '-') { neg = true; p++; }
+    switch (p < e ? *p : 0) {
+    case '$':  b = 16; p++; break;
+    case '#':  b = 10; p++; break;
+    case '%':  b = 2;  p++; break;
+    case '\'':                              /// * 'c' character literal
+        if (p + 3 != e || p[2] != '\'') return NUM_NA;
+        *n = neg ? -p[1] : p[1];
+        return NUM_SINGLE;
+    }
+    if (p < e && *p == '-') { neg = !neg; p++; }
+    if (p == e || (*p == '.' && p + 1 == e)) return NUM_NA;
+    int t = b == 10 ? scan_num<10>(p, e, b, n)
+          : b == 16 ? scan_num<16>(p, e, b, n)
+          : scan_num<0>(p, e, b, n);
+    if (neg && t == NUM_FLOAT) { DF r; memcpy(&r, n, sizeof(DF)); r = -r; memcpy(n, &r, sizeof(DF)); }
+    else if (neg) *n = (DU2)(0 - (uint64_t)*n);
+    return t;
 }
 ///
 /// outer interpreter
+///   ln - line number for error report (batch mode), 0 if none
+///   return false if an unknown token aborted the line
 ///
-void forth_outer(const char *cmd, void(*callback)(int, const char*)) {
+void interp_word(int w) {
+    if (compile && !dict[w].immd) {          /// * in compile mode?
+        add_iu(w);                           /// * add found word to new colon word
+    }
+    else CALL(w);                            /// * execute forth word
+}
+void interp_num(DU2 n, int t) {
+    if (t == NUM_FLOAT) {                    /// * float literal
+        DF r; memcpy(&r, &n, sizeof(DF));
+        if (compile) { add_iu(DOFLIT); add_df(r); }
+        else fss.push(r);
+        return;
+    }
+    if (compile) {                           /// * add literal when in compile mode
+        add_iu(DOLIT);                       ///> dovar (+parameter field)
+        add_du((DU)n);                       ///> data storage (32-bit integer now)
+        if (t == NUM_DOUBLE) {               ///> high cell of a double
+            add_iu(DOLIT);
+            add_du(dhi(n));
+        }
+    }
+    else {                                   ///> or, add value onto data stack
+        PUSH((DU)n);
+        if (t == NUM_DOUBLE) PUSH(dhi(n));
+    }
+}
+void interp_err(const char *idiom, int ln) {
+    if (ln) fout << "line " << ln << ": ";
+    fout << idiom << "? " << ENDL;           ///> display error prompt
+    compile = false;                         ///> reset to interpreter mode
+    txn_abort();                             ///> drop the half-built word
+}
+bool forth_eval(const char *cmd, int ln=0) {
     fin.clear();                             /// clear input stream error bit if any
     fin.str(cmd);                            /// feed user command into input stream
-    fout_cb = callback;                      /// setup callback function
-    fout.str("");                            /// clean output buffer, ready for next run
     while (fin >> strbuf) {
         const char *idiom = strbuf.c_str();
         //printf("%s=>", idiom);
-        int w = find(idiom);                 /// * search through dictionary
-        if (w>=0) {                          /// * word found?
-            //printf("%s %d\n", dict[w].name, w);
-            if (compile && !dict[w].immd) {  /// * in compile mode?
-                add_iu(w);                   /// * add found word to new colon word
+        try {
+            int w = find(idiom);             /// * search through dictionary
+            if (w>=0) {                      /// * word found?
+                //printf("%s %d\n", dict[w].name, w);
+                interp_word(w);
+                continue;
             }
-            else CALL(w);                    /// * execute forth word
-            continue;
-        }
-        // try as a number
-        char *p;
-        int n = static_cast<int>(strtol(idiom, &p, base));
-        //printf("%d\n", n);
-        if (*p != '\0') {                    /// * not number
-            fout << idiom << "? " << ENDL;   ///> display error prompt
-            compile = false;                 ///> reset to interpreter mode
-            break;                           ///> skip the entire input buffer
+            // try as a number
+            DU2 n;
+            int t = number(idiom, strbuf.length(), &n);
+            //printf("%d\n", n);
+            if (t == NUM_NA) {               /// * not number
+                interp_err(idiom, ln);
+                return false;                ///> skip the entire input buffer
+            }
+            interp_num(n, t);                /// * is a number
         }
-        // is a number
-        if (compile) {                       /// * add literal when in compile mode
-            add_iu(DOLIT);                   ///> dovar (+parameter field)
-            add_du(n);                       ///> data storage (32-bit integer now)
+        catch (const char *e) {              /// * e.g. overlay full
+            interp_err(e, ln);
+            return false;
         }
-        else PUSH(n);                        ///> or, add value onto data stack
     }
+    return true;
+}
+void forth_outer(const char *cmd, void(*callback)(int, const char*)) {
+    fout_cb = callback;                      /// setup callback function
+    fout.str("");                            /// clean output buffer, ready for next run
+    forth_eval(cmd);
     if (!compile) ss_dump();
 }
+///
+/// batch evaluation - run a multi-line buffer with a single prompt at the end
+/// Note:
+///   * output is held and sent in FOUT_CHUNK pieces instead of one per line
+///   * errors are reported with their line number, later lines still run
+///   * return number of lines in error
+///
+int forth_batch(const char *buf, void(*callback)(int, const char*)) {
+    fout_cb = callback;
+    fout.str("");
+    batch = true;
+    int err = 0;
+    for (int ln = 1; *buf; ln++) {
+        const char *eol = strchr(buf, '\n');
+        int n = eol ? eol - buf : strlen(buf);
+        string line(buf, n);
+        if (!forth_eval(line.c_str(), ln)) err++;
+        buf += eol ? n + 1 : n;
+    }
+    batch = false;
+    if (!compile) ss_dump();
+    else fout_flush(true);
+    return err;
+}
 ///==========================================================================
 /// ForthVM front-end handlers
 ///==========================================================================
@@ -626,8 +2460,10 @@ static void mem_stat() {
     LOGF("Core:");           LOG(xPortGetCoreID());
     LOGF(" heap[maxblk=");   LOG(heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
     LOGF(", avail=");        LOG(heap_caps_get_free_size(MALLOC_CAP_8BIT));
+#if HWM
     LOGF(", ss_max=");       LOG(ss.max);
     LOGF(", rs_max=");       LOG(rs.max);
+#endif // HWM
     LOGF(", pmem=");         LOG(HERE);
     LOGF("], lowest[heap="); LOG(heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
     LOGF(", stack=");        LOG(uxTaskGetStackHighWaterMark(NULL));
@@ -640,6 +2476,50 @@ static void mem_stat() {
 ///
 /// Forth bootstrap loader (from Flash)
 ///
+///   * a .tok file (made by tokenize-file) is replayed without text scanning
+///
+static void tok_skip_line() {                 /// after an error, on to the next T_EOL
+    while (tok < tok_end && *tok != T_EOL) {
+        tok += *tok == T_WORD ? 2 + tok[1]
+             : *tok == T_STR  ? 3 + (tok[1] | (tok[2] << 8))
+             : *tok == T_LIT  ? 1 + sizeof(DU) : 1 + sizeof(DU2);
+    }
+}
+static void forth_replay(const U8 *p, int sz) {
+    tok = p; tok_end = p + sz;
+    while (tok < tok_end) {
+        U8 t = *tok;
+        try {
+            switch (t) {
+            case T_WORD: {
+                const char *idiom = tok_text(T_WORD);
+                int w = find(idiom);
+                if (w >= 0) { interp_word(w); break; }
+                DU2 n;                        /// not known when tokenized
+                int nt = number(idiom, strbuf.length(), &n);
+                if (nt != NUM_NA) { interp_num(n, nt); break; }
+                interp_err(idiom, 0);         /// skip rest of the line
+                tok_skip_line();
+            } break;
+            case T_LIT:  {                    /// records are packed, copy not load
+                DU v; memcpy(&v, tok + 1, sizeof(DU));
+                interp_num(v, NUM_SINGLE); tok += 1 + sizeof(DU);
+            } break;
+            case T_DLIT: {
+                DU2 v; memcpy(&v, tok + 1, sizeof(DU2));
+                interp_num(v, NUM_DOUBLE); tok += 1 + sizeof(DU2);
+            } break;
+            case T_STR:  tok_text(T_STR); break;  /// stray text, nothing to consume it
+            default:     tok++; yield(); break;   /// T_EOL
+            }
+        }
+        catch (const char *e) {               /// * e.g. overlay full
+            interp_err(e, 0);
+            tok_skip_line();
+        }
+    }
+    tok = 0;
+}
 static int forth_load(const char *fname) {
     auto dummy = [](int, const char *) { /* do nothing */ };
     if (!SPIFFS.begin()) {
@@ -648,7 +2528,18 @@ static int forth_load(const char *fname) {
     if (!file) {
         LOGF("Error opening file:"); LOG(fname); return 1; }
     LOGF("Loading file: "); LOG(fname); LOGF("...");
-    while (file.available()) {
+    const char *ext = strrchr(fname, '.');
+    if (ext && strcmp(ext, ".tok")==0) {              // pre-tokenized
+        int sz  = file.size();
+        U8  *buf = (U8*)malloc(sz);
+        if (buf && (int)file.read(buf, sz) == sz) {
+            fout_cb = dummy;
+            forth_replay(buf, sz);
+        }
+        else LOGF("Error reading file");
+        free(buf);
+    }
+    else while (file.available()) {
         char cmd[256], *p = cmd, c;
         while ((c = file.read())!='\n') *p++ = c;   // one line a time
         *p = '\0';
@@ -659,16 +2550,129 @@ static int forth_load(const char *fname) {
     SPIFFS.end();
     return 0;
 }
+///
+/// tokenize-file - turn a Forth source into a .tok file for forth_load
+/// Note:
+///   * comments are dropped, numbers are stored parsed (base tracked through
+///   * hex/decimal while interpreting, left as text after base! or after a
+///   * definition that holds a base word, since running it later changes the
+///   * base), words are kept by name so one .tok works across boards whose
+///   * dictionaries differ
+///   * arguments of parsing words are stored as T_WORD/T_STR records
+///   * a word longer than 255 chars does not fit a T_WORD record, the file
+///     is refused and no .tok is left behind
+///
+int tokenize_file(const char *src, const char *dst) {
+    static const char *NAMED[] = {       /// words that take a name by next_word()
+        ":", "create", "variable", "constant", "'", "to", "is", "see", "forget", "key" };
+    static const char *SCANS[] = { ".\"", "$\"", ".(" };  /// words that scan() a text
+    static const char  DELIM[] = { '"',   '"',   ')'  };
+    if (!SPIFFS.begin()) {
+        LOGF("Error mounting SPIFFS"); return 1; }
+    File in  = SPIFFS.open(src, "r");
+    File out = SPIFFS.open(dst, "w");
+    string to  = dst;                        /// * dst may sit in strbuf
+    if (!in || !out) {
+        LOGF("Error opening file:"); LOG(src); return 1; }
+    int ln = 0, err = 0;                     /// source line, word too long
+    auto put = [&](U8 t, const void *p, int n) {
+        if (t == T_WORD && n > 0xff) {
+            if (!err++) { LOGF("Error: word too long, line "); LOG(ln); LOGF("\n"); }
+            return;
+        }
+        U8 h[3] = { t, (U8)n, (U8)(n >> 8) };
+        out.write(h, t == T_WORD ? 2 : t == T_STR ? 3 : 1);
+        if (n) out.write((const U8*)p, n);
+    };
+    string save = fin.str();                 /// keep the caller's input line
+    auto   pos  = fin.tellg();
+    DU     b0   = base, b = 10;              /// base as the replay at boot sees it
+    bool   def  = false;                     /// inside : ... ;
+    while (in.available()) {
+        string cmd;
+        for (char c; in.available() && (c = in.read()) != '\n';) cmd += c;
+        fin.clear(); fin.str(cmd); ln++;
+        while (fin >> strbuf) {
+            string w = strbuf;
+            const char *s = w.c_str();
+            if (streq(s, "("))  { scan(')'); continue; }
+            if (streq(s, "\\")) break;
+            DU2 n; int t = NUM_NA;
+            if (b && find(s) < 0) { base = b; t = number(s, w.length(), &n); base = b0; }
+            if (t == NUM_SINGLE) { DU v = (DU)n; put(T_LIT, &v, sizeof(DU)); continue; }
+            if (t == NUM_DOUBLE) { put(T_DLIT, &n, sizeof(DU2)); continue; }
+            put(T_WORD, s, w.length());
+            bool bw = streq(s, "hex") || streq(s, "decimal") || streq(s, "base!");
+            if      (streq(s, ":"))       def = true;
+            else if (streq(s, ";"))       def = false;
+            else if (bw && def)           b = 0;  /// * runs later, unknown from here on
+            else if (streq(s, "hex"))     b = 16;
+            else if (streq(s, "decimal")) b = 10;
+            else if (streq(s, "base!"))   b = 0;  /// unknown from here on
+            for (auto nm : NAMED) {
+                if (!streq(s, nm)) continue;
+                const char *a = next_word(); put(T_WORD, a, strlen(a));
+            }
+            for (int i = 0; i < (int)(sizeof(SCANS)/sizeof(SCANS[0])); i++) {
+                if (!streq(s, SCANS[i])) continue;
+                const char *a = scan(DELIM[i]); put(T_STR, a, strlen(a));
+            }
+        }
+        put(T_EOL, 0, 0);
+    }
+    in.close(); out.close();
+    if (err) SPIFFS.remove(to.c_str());      /// * a broken .tok must not boot
+    SPIFFS.end();
+    fin.clear(); fin.str(save); fin.seekg(pos);
+    return err ? 1 : 0;
+}
 
 void forth_setup() {
     ///
     /// ForthVM initalization
     ///
     forth_init();
-    //forth_load("/load.txt");    // compile /data/load.txt
+    //if (forth_load("/load.tok"))  // replay /data/load.tok (see tokenize-file)
+    //    forth_load("/load.txt");  // or compile /data/load.txt
+    //ovl_freeze();                 // share the boot image with later VMs
 
     mem_stat();
 }
+///
+/// ForthVM proxy - one per FreeRTOS task (pthread on host)
+/// Note:
+///   * stacks, IP, base, fin/fout... are thread_local (MULTI_VM), so each task
+///     running a ForthVM has its own interpreter, dict and pmem are shared
+///   * the first init() builds the dictionary, once it is frozen (freeze)
+///     every other VM gets its own overlay to define into
+///   * init() returns false if there is no dictionary for this VM (base not
+///     frozen yet, or all OVL_MAX overlays taken), outer() and batch() then
+///     refuse to run rather than compile over the shared base
+///
+struct ForthVM {
+    ~ForthVM()      { ovl_release(); }
+    bool init()     {
+        if (dict.idx)       vm_reset();     /// * this VM again
+        else if (ovl_attach()) vm_reset();  /// * another VM on the frozen base
+        else if (!base_didx && !dict_ok) forth_init();
+        else if (base_didx) LOGF("ERR: no free overlay\n");
+        else LOGF("ERR: freeze the base dictionary first\n");
+        return ready();
+    }
+    bool ready()    { return dict.idx > 0; }    /// * own view of the dictionary
+    bool freeze()   { return ovl_freeze(); }
+    void outer(const char *cmd, void(*cb)(int, const char*)) {
+        if (ready()) forth_outer(cmd, cb);
+        else cb(0, "ERR: VM not initialized\n");
+    }
+    int  batch(const char *buf, void(*cb)(int, const char*)) {
+        if (ready()) return forth_batch(buf, cb);
+        cb(0, "ERR: VM not initialized\n");
+        return -1;
+    }
+    void mem_stat() { ::mem_stat(); }
+    const char *version() { return "8.1"; }
+};
 ///==========================================================================
 /// ESP32 Web Serer connection and index page
 ///==========================================================================
@@ -729,10 +2733,82 @@ Transfer-Encoding: chunked
 
 )XX";
 
+ForthVM vm;                   /// instantiate a ForthVM proxy object
+#if IO_SPLIT
+///
+/// lock-free single-producer/single-consumer ring
+///   head is written by the producer only, tail by the consumer only
+///
+template<class T, int N>                    /// N must be a power of 2
+struct Ring {
+    T v[N];
+    atomic<U32> head{0}, tail{0};
+    bool put(const T &t) {
+        U32 h = head.load(memory_order_relaxed);
+        if (h - tail.load(memory_order_acquire) == N) return false;
+        v[h & (N - 1)] = t;
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+    bool get(T &t) {
+        U32 r = tail.load(memory_order_relaxed);
+        if (head.load(memory_order_acquire) == r) return false;
+        t = v[r & (N - 1)];
+        tail.store(r + 1, memory_order_release);
+        return true;
+    }
+};
+///
+/// I/O task <=> VM hand-off
+/// Note:
+///   * cmd_q carries commands to loop(), out_q carries output back,
+///     each message is a heap string freed by its receiver
+///   * an output message with txt == NULL ends the reply to one command
+///   * io_task never waits for a reply, web clients owed one are queued in
+///     ForthServer and their output is routed as it comes, see io_route
+///
+enum { IO_CON = 0, IO_WEB };
+struct IoMsg { int src; char *txt; };
+Ring<IoMsg, 16> cmd_q;                      /// I/O task => VM
+Ring<IoMsg, 64> out_q;                      /// VM => I/O task
+Ring<char, 256> key_q;                      /// I/O task => key, while key_want
+atomic<bool>    key_want{false};
+int io_src;                                 /// source of the command being run
+template<class R>
+void io_put(R &q, IoMsg m) { while (!q.put(m)) delay(1); }   /** full ring, wait */
+void io_post(int src, const char *cmd) { io_put(cmd_q, { src, strdup(cmd) }); }
+void io_out(int, const char *msg)      { io_put(out_q, { io_src, strdup(msg) }); }
+void vm_poll() {                            /** VM side, run one pending command */
+    IoMsg m;
+    if (!cmd_q.get(m)) return;
+    io_src = m.src;
+    if (m.src == IO_WEB) vm.batch(m.txt, io_out);
+    else { vm.outer(m.txt, io_out); vm.mem_stat(); }
+    free(m.txt);
+    io_put(out_q, { m.src, NULL });
+}
+#endif // IO_SPLIT
+DU vm_key() {                               /** key past the input line, other tasks run meanwhile */
+#if IO_SPLIT
+    char c;
+    key_want = true;                        /// * io_task feeds key_q instead of cmd_q
+    while (!key_q.get(c)) task_idle(1);
+    key_want = false;
+    return c;
+#else  // IO_SPLIT
+    while (!Serial.available()) task_idle(1);
+    return Serial.read();
+#endif // IO_SPLIT
+}
 namespace ForthServer {
     WiFiServer server;
     WiFiClient client;
     String     http_req;
+#if IO_SPLIT
+#define WAIT_MAX 4
+    WiFiClient wait_q[WAIT_MAX];                    /// clients owed a reply, in cmd_q order
+    int        wait_n = 0;
+#endif // IO_SPLIT
     int readline() {
         http_req.clear();
         while (client.connected()) {
@@ -748,41 +2824,68 @@ namespace ForthServer {
         client.println(HTML_INDEX);                 ///
         delay(30);                   // give browser sometime to receive
     }
-    void send_chunk(int len, const char *msg) {
+    void chunk_to(WiFiClient &c, int len, const char *msg) {
         Serial.print(msg);
-        client.println(len, HEX);
-        client.println(msg);
+        c.println(len, HEX);
+        c.println(msg);
         yield();
     }
-    void handle_input() {
+    void send_chunk(int len, const char *msg) { chunk_to(client, len, msg); }
+    bool handle_input() {                           /** true if the reply is still owed */
         while (readline() && http_req.length()>0);  /// skip HTTP header
         for (int i=0; i<4 && readline(); i++) {     /// find Forth command token
             if (http_req.startsWith("---CMD")) break;
         }
         // process Forth command, return in chunks
         client.println(HTML_CHUNKED);               /// send HTTP chunked header
+        String cmd;                                 /// collect all lines of the POST
         for (int i=0; readline(); i++) {
             if (http_req.startsWith("---CMD")) break;
-            if (http_req.length() > 0) {
-                Serial.println(http_req);           /// echo on console
-                forth_outer(http_req.c_str(), send_chunk);
-            }
+            if (http_req.length() > 0) Serial.println(http_req);  /// echo on console
+            cmd += http_req; cmd += '\n';            /// * blank ones too, keeps line numbers
         }
+#if IO_SPLIT
+        io_post(IO_WEB, cmd.c_str());               /// run them on the VM core
+        wait_q[wait_n++] = client;                  /// * io_route streams the output back
+        return true;
+#else  // IO_SPLIT
+        vm.batch(cmd.c_str(), send_chunk);          /// run them in one go
         send_chunk(0, "\r\n");                      /// close HTTP chunk stream
+        return false;
+#endif // IO_SPLIT
+    }
+#if IO_SPLIT
+    void io_route(IoMsg &m) {                       /** one VM output message to its reader */
+        if (m.src != IO_WEB) {                      /// * console
+            if (m.txt) { Serial.print(m.txt); free(m.txt); }
+            return;
+        }
+        if (!wait_n) { free(m.txt); return; }       /// * nobody to send it to
+        WiFiClient &c = wait_q[0];
+        if (m.txt) { chunk_to(c, strlen(m.txt), m.txt); free(m.txt); return; }
+        chunk_to(c, 0, "\r\n");                     /// close HTTP chunk stream
+        c.stop();
+        for (int i = 1; i < wait_n; i++) wait_q[i - 1] = wait_q[i];
+        wait_q[--wait_n] = WiFiClient();
     }
+#endif // IO_SPLIT
     void handle_client() {                          /// uri router
+#if IO_SPLIT
+        if (wait_n == WAIT_MAX) return;             /// * replies owed, accept later
+#endif // IO_SPLIT
         if (!(client = server.available())) return;
+        bool owed = false;
         while (readline()) {
             if (http_req.startsWith("GET /")) {
                 handle_index();
                 break;
             }
             else if (http_req.startsWith("POST /input")) {
-                handle_input();
+                owed = handle_input();
                 break;
             }
         }
-        client.stop();
+        if (!owed) client.stop();
         yield();
     }
     void setup(const char *ssid, const char *pass) {
@@ -799,6 +2902,28 @@ namespace ForthServer {
         http_req.reserve(256);
     }
 };
+#if IO_SPLIT
+///
+/// I/O task, pinned to IO_CORE, never runs Forth itself
+///
+void io_task(void *) {
+    for (;;) {
+        ForthServer::handle_client();
+        if (key_want) {                      /// * a VM waits in key
+            while (Serial.available() && key_q.put((char)Serial.read()));
+        }
+        else if (Serial.available()) {
+            String cmd = Serial.readString();
+            LOG(cmd);
+            io_post(IO_CON, cmd.c_str());
+        }
+        for (IoMsg m; out_q.get(m); ) {      /// VM output, to console or web client
+            ForthServer::io_route(m);
+        }
+        delay(2);
+    }
+}
+#endif // IO_SPLIT
 
 ///==========================================================================
 /// ESP32 routines
@@ -829,12 +2954,19 @@ void setup() {
     ForthServer::setup(WIFI_SSID, WIFI_PASS);
     forth_setup();
     console_cmd.reserve(256);
+#if IO_SPLIT
+    xTaskCreatePinnedToCore(io_task, "io", 8192, NULL, 1, NULL, IO_CORE);
+#endif // IO_SPLIT
     LOGF("\nesp32forth8\n");
 }
 
 void loop(void) {
+#if IO_SPLIT
+    vm_poll();             // commands come from io_task on the other core
+    task_sleep(2);         // run Forth tasks, yield to background tasks (interrupt, timer,...)
+#else  // IO_SPLIT
     ForthServer::handle_client();
-    delay(2);              // yield to background tasks (interrupt, timer,...)
+    task_sleep(2);         // run Forth tasks, yield to background tasks (interrupt, timer,...)
     ///
     /// while Web requests come in from handleInput asynchronously,
     /// we also take user input from console (for debugging mostly)
@@ -844,8 +2976,9 @@ void loop(void) {
     if (Serial.available()) {
         console_cmd = Serial.readString();
         LOG(console_cmd);
-        forth_outer(console_cmd.c_str(), send_to_con);
-        mem_stat();
+        vm.outer(console_cmd.c_str(), send_to_con);
+        vm.mem_stat();
         delay(2);
     }
+#endif // IO_SPLIT
 }
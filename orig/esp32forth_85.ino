@@ -28,7 +28,7 @@ typedef uint32_t   U32;
 #define LOGF(s)    Serial.print(F(s))
 #define LOG(v)     Serial.print(v)
 #define LOGH(v)    Serial.print(v, HEX)
-#define ENDL       endl; yield()
+#define ENDL       endl
 
 ///==========================================================================
 /// ForthVM global variables
@@ -50,9 +50,11 @@ U8  *cDict = (U8*)iDict;              /// byte array alias
 ///==========================================================================
 /// Named functions
 ///==========================================================================
+int slice = 1000, budget = 1000;      /// bytecodes between yield(), see run()
+void tick()       { if (budget <= 0) { budget = slice; yield(); } }
 void next()       { P = iDict[IP >> 2]; WP = P; IP += 4; }
 void nest()       { pushR = IP; IP = WP + 4; next(); }
-void unnest()     { IP = popR; next(); }            // inner interpreter
+void unnest()     { IP = popR; tick(); next(); }    // inner interpreter
 void comma(int n) { iDict[DP >> 2] = n; DP += 4; }  /// compiler
 void comma_s(int lex, string s) {                   /// string compiler
     comma(lex);
@@ -80,7 +82,6 @@ int find(string s) {            /// scan dictionary, return cfa or 0
                     : (*c == *p);                   /// case insensitive
             }
             if (ok) {
-                yield();
                 cfa = ALIGN(nfa + len + 1);
                 pfa = cfa + 4;
                 return cfa;
@@ -89,7 +90,6 @@ int find(string s) {            /// scan dictionary, return cfa or 0
         lfa = nfa -4;            /// need to see
         nfa = iDict[lfa >> 2];   /// link field to previous word
     }
-    yield();
     return 0;
 }
 void printName(int n) {           /// print name from cfa
@@ -174,13 +174,18 @@ static struct Code primitives[] = {
          IP = ALIGN(IP)),
     CODE("dodoes", 
         pushR =IP; IP = iDict[(WP + 4) >> 2]; push (WP+8); next(); ),
-    CODE("branch", IP = iDict[IP >> 2]; next()),
+    CODE("branch",
+         if (iDict[IP >> 2] < IP) tick();    /// backward, again/repeat
+         IP = iDict[IP >> 2]; next()),
     CODE("0branch",
-         if (top == 0) IP = iDict[IP >> 2];
+         if (top == 0) {
+             if (iDict[IP >> 2] < IP) tick(); /// backward, until
+             IP = iDict[IP >> 2];
+         }
          else IP += 4;  pop; next()),
     CODE("donext",
          if (rStack[R]) {
-             rStack[R] -= 1; IP = iDict[IP >> 2];
+             rStack[R] -= 1; IP = iDict[IP >> 2]; tick();
          }
          else { IP += 4;  R--; }
          next()),
@@ -348,6 +353,7 @@ static struct Code primitives[] = {
     CODE("peek",  int a = top; pop; push PEEK(a)),
     CODE("poke",  int a = top; pop; POKE(a, top); pop),
     CODE("delay", delay(top); pop),
+    CODE("slice", slice = budget = top < 1 ? 1 : top; pop),
     CODE("pin",   int p = top; pop; pinMode(p, top); pop),
     CODE("in",    int p = top; pop; push digitalRead(p)),
     CODE("out",   int p = top; pop; digitalWrite(p, top); pop),
@@ -376,6 +382,7 @@ void run(int n) { /// inner interpreter, P, WP, IP, R, bytecode modified
     P = n; WP = n; IP = 0; R = 0;
     do {
         bytecode = cDict[P++];       /// fetch bytecode
+        budget--;                    /// yield() only when used up, see tick()
         primitives[bytecode].xt();   /// execute colon byte-by-byte
     } while (R != 0);
 }
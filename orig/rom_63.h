@@ -0,0 +1,2172 @@
+
+long data[16000] = {
+/* 00000000 */ 0x00000000,
+/* 00000004 */ 0x00000000,
+/* 00000008 */ 0x00000000,
+/* 0000000C */ 0x00000000,
+/* 00000010 */ 0x00000000,
+/* 00000014 */ 0x00000000,
+/* 00000018 */ 0x00000000,
+/* 0000001C */ 0x00000000,
+/* 00000020 */ 0x00000000,
+/* 00000024 */ 0x00000000,
+/* 00000028 */ 0x00000000,
+/* 0000002C */ 0x00000000,
+/* 00000030 */ 0x00000000,
+/* 00000034 */ 0x00000000,
+/* 00000038 */ 0x00000000,
+/* 0000003C */ 0x00000000,
+/* 00000040 */ 0x00000000,
+/* 00000044 */ 0x00000000,
+/* 00000048 */ 0x00000000,
+/* 0000004C */ 0x00000000,
+/* 00000050 */ 0x00000000,
+/* 00000054 */ 0x00000000,
+/* 00000058 */ 0x00000000,
+/* 0000005C */ 0x00000000,
+/* 00000060 */ 0x00000000,
+/* 00000064 */ 0x00000000,
+/* 00000068 */ 0x00000000,
+/* 0000006C */ 0x00000000,
+/* 00000070 */ 0x00000000,
+/* 00000074 */ 0x00000000,
+/* 00000078 */ 0x00000000,
+/* 0000007C */ 0x00000000,
+/* 00000080 */ 0x00000000,
+/* 00000084 */ 0x00000000,
+/* 00000088 */ 0x00000000,
+/* 0000008C */ 0x00000000,
+/* 00000090 */ 0x00000000,
+/* 00000094 */ 0x00000000,
+/* 00000098 */ 0x00000000,
+/* 0000009C */ 0x00000000,
+/* 000000A0 */ 0x00000000,
+/* 000000A4 */ 0x00000000,
+/* 000000A8 */ 0x00000000,
+/* 000000AC */ 0x00000000,
+/* 000000B0 */ 0x00000000,
+/* 000000B4 */ 0x00000000,
+/* 000000B8 */ 0x00000000,
+/* 000000BC */ 0x00000000,
+/* 000000C0 */ 0x00000000,
+/* 000000C4 */ 0x00000000,
+/* 000000C8 */ 0x00000000,
+/* 000000CC */ 0x00000000,
+/* 000000D0 */ 0x00000000,
+/* 000000D4 */ 0x00000000,
+/* 000000D8 */ 0x00000000,
+/* 000000DC */ 0x00000000,
+/* 000000E0 */ 0x00000000,
+/* 000000E4 */ 0x00000000,
+/* 000000E8 */ 0x00000000,
+/* 000000EC */ 0x00000000,
+/* 000000F0 */ 0x00000000,
+/* 000000F4 */ 0x00000000,
+/* 000000F8 */ 0x00000000,
+/* 000000FC */ 0x00000000,
+/* 00000100 */ 0x00000000,
+/* 00000104 */ 0x00000000,
+/* 00000108 */ 0x00000000,
+/* 0000010C */ 0x00000000,
+/* 00000110 */ 0x00000000,
+/* 00000114 */ 0x00000000,
+/* 00000118 */ 0x00000000,
+/* 0000011C */ 0x00000000,
+/* 00000120 */ 0x00000000,
+/* 00000124 */ 0x00000000,
+/* 00000128 */ 0x00000000,
+/* 0000012C */ 0x00000000,
+/* 00000130 */ 0x00000000,
+/* 00000134 */ 0x00000000,
+/* 00000138 */ 0x00000000,
+/* 0000013C */ 0x00000000,
+/* 00000140 */ 0x00000000,
+/* 00000144 */ 0x00000000,
+/* 00000148 */ 0x00000000,
+/* 0000014C */ 0x00000000,
+/* 00000150 */ 0x00000000,
+/* 00000154 */ 0x00000000,
+/* 00000158 */ 0x00000000,
+/* 0000015C */ 0x00000000,
+/* 00000160 */ 0x00000000,
+/* 00000164 */ 0x00000000,
+/* 00000168 */ 0x00000000,
+/* 0000016C */ 0x00000000,
+/* 00000170 */ 0x00000000,
+/* 00000174 */ 0x00000000,
+/* 00000178 */ 0x00000000,
+/* 0000017C */ 0x00000000,
+/* 00000180 */ 0x00000006,
+/* 00000184 */ 0x00001570,
+/* 00000188 */ 0x00000000,
+/* 0000018C */ 0x00000000,
+/* 00000190 */ 0x00000000,
+/* 00000194 */ 0x00000000,
+/* 00000198 */ 0x00000000,
+/* 0000019C */ 0x00000000,
+/* 000001A0 */ 0x00000000,
+/* 000001A4 */ 0x00000010,
+/* 000001A8 */ 0x000021BC,
+/* 000001AC */ 0x000021E4,
+/* 000001B0 */ 0x000021BC,
+/* 000001B4 */ 0x0000147C,
+/* 000001B8 */ 0x00001570,
+/* 000001BC */ 0x00000000,
+/* 000001C0 */ 0x00000000,
+/* 000001C4 */ 0x00000000,
+/* 000001C8 */ 0x00000000,
+/* 000001CC */ 0x00000000,
+/* 000001D0 */ 0x00000000,
+/* 000001D4 */ 0x00000000,
+/* 000001D8 */ 0x00000000,
+/* 000001DC */ 0x00000000,
+/* 000001E0 */ 0x00000000,
+/* 000001E4 */ 0x00000000,
+/* 000001E8 */ 0x00000000,
+/* 000001EC */ 0x00000000,
+/* 000001F0 */ 0x00000000,
+/* 000001F4 */ 0x00000000,
+/* 000001F8 */ 0x00000000,
+/* 000001FC */ 0x00000000,
+/* 00000200 */ 0x00000000,
+/* 00000204 */ 0x444C4803,
+/* 00000208 */ 0x00002004,
+/* 0000020C */ 0x00000190,
+/* 00000210 */ 0x00000204,
+/* 00000214 */ 0x41505304,
+/* 00000218 */ 0x0000004E,
+/* 0000021C */ 0x00002004,
+/* 00000220 */ 0x00000194,
+/* 00000224 */ 0x00000214,
+/* 00000228 */ 0x4E493E03,
+/* 0000022C */ 0x00002004,
+/* 00000230 */ 0x00000198,
+/* 00000234 */ 0x00000228,
+/* 00000238 */ 0x49542304,
+/* 0000023C */ 0x00000042,
+/* 00000240 */ 0x00002004,
+/* 00000244 */ 0x0000019C,
+/* 00000248 */ 0x00000238,
+/* 0000024C */ 0x49542704,
+/* 00000250 */ 0x00000042,
+/* 00000254 */ 0x00002004,
+/* 00000258 */ 0x000001A0,
+/* 0000025C */ 0x0000024C,
+/* 00000260 */ 0x53414204,
+/* 00000264 */ 0x00000045,
+/* 00000268 */ 0x00002004,
+/* 0000026C */ 0x000001A4,
+/* 00000270 */ 0x00000260,
+/* 00000274 */ 0x4E4F4307,
+/* 00000278 */ 0x54584554,
+/* 0000027C */ 0x00002004,
+/* 00000280 */ 0x000001A8,
+/* 00000284 */ 0x00000274,
+/* 00000288 */ 0x00504302,
+/* 0000028C */ 0x00002004,
+/* 00000290 */ 0x000001AC,
+/* 00000294 */ 0x00000288,
+/* 00000298 */ 0x53414C04,
+/* 0000029C */ 0x00000054,
+/* 000002A0 */ 0x00002004,
+/* 000002A4 */ 0x000001B0,
+/* 000002A8 */ 0x00000298,
+/* 000002AC */ 0x56452705,
+/* 000002B0 */ 0x00004C41,
+/* 000002B4 */ 0x00002004,
+/* 000002B8 */ 0x000001B4,
+/* 000002BC */ 0x000002AC,
+/* 000002C0 */ 0x42412706,
+/* 000002C4 */ 0x0054524F,
+/* 000002C8 */ 0x00002004,
+/* 000002CC */ 0x000001B8,
+/* 000002D0 */ 0x000002C0,
+/* 000002D4 */ 0x706D7403,
+/* 000002D8 */ 0x00002004,
+/* 000002DC */ 0x000001BC,
+/* 000002E0 */ 0x000002D4,
+/* 000002E4 */ 0x00005A01,
+/* 000002E8 */ 0x00002004,
+/* 000002EC */ 0x00000000,
+/* 000002F0 */ 0x000002E4,
+/* 000002F4 */ 0x71707004,
+/* 000002F8 */ 0x0000006E,
+/* 000002FC */ 0x00002004,
+/* 00000300 */ 0x000001C0,
+/* 00000304 */ 0x000002F4,
+/* 00000308 */ 0x61686307,
+/* 0000030C */ 0x6C656E6E,
+/* 00000310 */ 0x00002004,
+/* 00000314 */ 0x000001C4,
+/* 00000318 */ 0x00000308,
+/* 0000031C */ 0x504F4E03,
+/* 00000320 */ 0x00002000,
+/* 00000324 */ 0x0000031C,
+/* 00000328 */ 0x43434106,
+/* 0000032C */ 0x00545045,
+/* 00000330 */ 0x00002001,
+/* 00000334 */ 0x00000328,
+/* 00000338 */ 0x454B3F04,
+/* 0000033C */ 0x00000059,
+/* 00000340 */ 0x00002002,
+/* 00000344 */ 0x00000338,
+/* 00000348 */ 0x494D4504,
+/* 0000034C */ 0x00000054,
+/* 00000350 */ 0x00002003,
+/* 00000354 */ 0x00000348,
+/* 00000358 */ 0x4C4F4405,
+/* 0000035C */ 0x00005449,
+/* 00000360 */ 0x00002005,
+/* 00000364 */ 0x00000358,
+/* 00000368 */ 0x4C4F4406,
+/* 0000036C */ 0x00545349,
+/* 00000370 */ 0x00002006,
+/* 00000374 */ 0x00000368,
+/* 00000378 */ 0x49584504,
+/* 0000037C */ 0x00000054,
+/* 00000380 */ 0x00002007,
+/* 00000384 */ 0x00000378,
+/* 00000388 */ 0x45584507,
+/* 0000038C */ 0x45545543,
+/* 00000390 */ 0x00002008,
+/* 00000394 */ 0x00000388,
+/* 00000398 */ 0x4E4F4406,
+/* 0000039C */ 0x00545845,
+/* 000003A0 */ 0x00002009,
+/* 000003A4 */ 0x00000398,
+/* 000003A8 */ 0x52425107,
+/* 000003AC */ 0x48434E41,
+/* 000003B0 */ 0x0000200A,
+/* 000003B4 */ 0x000003A8,
+/* 000003B8 */ 0x41524206,
+/* 000003BC */ 0x0048434E,
+/* 000003C0 */ 0x0000200B,
+/* 000003C4 */ 0x000003B8,
+/* 000003C8 */ 0x00002101,
+/* 000003CC */ 0x0000200C,
+/* 000003D0 */ 0x000003C8,
+/* 000003D4 */ 0x00004001,
+/* 000003D8 */ 0x0000200D,
+/* 000003DC */ 0x000003D4,
+/* 000003E0 */ 0x00214302,
+/* 000003E4 */ 0x0000200E,
+/* 000003E8 */ 0x000003E0,
+/* 000003EC */ 0x00404302,
+/* 000003F0 */ 0x0000200F,
+/* 000003F4 */ 0x000003EC,
+/* 000003F8 */ 0x003E5202,
+/* 000003FC */ 0x00002012,
+/* 00000400 */ 0x000003F8,
+/* 00000404 */ 0x00405202,
+/* 00000408 */ 0x00002013,
+/* 0000040C */ 0x00000404,
+/* 00000410 */ 0x00523E02,
+/* 00000414 */ 0x00002014,
+/* 00000418 */ 0x00000410,
+/* 0000041C */ 0x4F524404,
+/* 00000420 */ 0x00000050,
+/* 00000424 */ 0x00002017,
+/* 00000428 */ 0x0000041C,
+/* 0000042C */ 0x50554403,
+/* 00000430 */ 0x00002018,
+/* 00000434 */ 0x0000042C,
+/* 00000438 */ 0x41575304,
+/* 0000043C */ 0x00000050,
+/* 00000440 */ 0x00002019,
+/* 00000444 */ 0x00000438,
+/* 00000448 */ 0x45564F04,
+/* 0000044C */ 0x00000052,
+/* 00000450 */ 0x0000201A,
+/* 00000454 */ 0x00000448,
+/* 00000458 */ 0x003C3002,
+/* 0000045C */ 0x0000201B,
+/* 00000460 */ 0x00000458,
+/* 00000464 */ 0x444E4103,
+/* 00000468 */ 0x0000201C,
+/* 0000046C */ 0x00000464,
+/* 00000470 */ 0x00524F02,
+/* 00000474 */ 0x0000201D,
+/* 00000478 */ 0x00000470,
+/* 0000047C */ 0x524F5803,
+/* 00000480 */ 0x0000201E,
+/* 00000484 */ 0x0000047C,
+/* 00000488 */ 0x2B4D5503,
+/* 0000048C */ 0x0000201F,
+/* 00000490 */ 0x00000488,
+/* 00000494 */ 0x55443F04,
+/* 00000498 */ 0x00000050,
+/* 0000049C */ 0x00002021,
+/* 000004A0 */ 0x00000494,
+/* 000004A4 */ 0x544F5203,
+/* 000004A8 */ 0x00002022,
+/* 000004AC */ 0x000004A4,
+/* 000004B0 */ 0x52443205,
+/* 000004B4 */ 0x0000504F,
+/* 000004B8 */ 0x00002023,
+/* 000004BC */ 0x000004B0,
+/* 000004C0 */ 0x55443204,
+/* 000004C4 */ 0x00000050,
+/* 000004C8 */ 0x00002024,
+/* 000004CC */ 0x000004C0,
+/* 000004D0 */ 0x00002B01,
+/* 000004D4 */ 0x00002025,
+/* 000004D8 */ 0x000004D0,
+/* 000004DC */ 0x544F4E03,
+/* 000004E0 */ 0x00002026,
+/* 000004E4 */ 0x000004DC,
+/* 000004E8 */ 0x47454E06,
+/* 000004EC */ 0x00455441,
+/* 000004F0 */ 0x00002027,
+/* 000004F4 */ 0x000004E8,
+/* 000004F8 */ 0x454E4407,
+/* 000004FC */ 0x45544147,
+/* 00000500 */ 0x00002028,
+/* 00000504 */ 0x000004F8,
+/* 00000508 */ 0x00002D01,
+/* 0000050C */ 0x00002029,
+/* 00000510 */ 0x00000508,
+/* 00000514 */ 0x53424103,
+/* 00000518 */ 0x0000202A,
+/* 0000051C */ 0x00000514,
+/* 00000520 */ 0x00003D01,
+/* 00000524 */ 0x0000202B,
+/* 00000528 */ 0x00000520,
+/* 0000052C */ 0x003C5502,
+/* 00000530 */ 0x0000202C,
+/* 00000534 */ 0x0000052C,
+/* 00000538 */ 0x00003C01,
+/* 0000053C */ 0x0000202D,
+/* 00000540 */ 0x00000538,
+/* 00000544 */ 0x2F4D5506,
+/* 00000548 */ 0x00444F4D,
+/* 0000054C */ 0x0000202E,
+/* 00000550 */ 0x00000544,
+/* 00000554 */ 0x4D2F4D05,
+/* 00000558 */ 0x0000444F,
+/* 0000055C */ 0x0000202F,
+/* 00000560 */ 0x00000554,
+/* 00000564 */ 0x4F4D2F04,
+/* 00000568 */ 0x00000044,
+/* 0000056C */ 0x00002030,
+/* 00000570 */ 0x00000564,
+/* 00000574 */ 0x444F4D03,
+/* 00000578 */ 0x00002031,
+/* 0000057C */ 0x00000574,
+/* 00000580 */ 0x00002F01,
+/* 00000584 */ 0x00002032,
+/* 00000588 */ 0x00000580,
+/* 0000058C */ 0x2A4D5503,
+/* 00000590 */ 0x00002033,
+/* 00000594 */ 0x0000058C,
+/* 00000598 */ 0x00002A01,
+/* 0000059C */ 0x00002034,
+/* 000005A0 */ 0x00000598,
+/* 000005A4 */ 0x002A4D02,
+/* 000005A8 */ 0x00002035,
+/* 000005AC */ 0x000005A4,
+/* 000005B0 */ 0x4D2F2A05,
+/* 000005B4 */ 0x0000444F,
+/* 000005B8 */ 0x00002036,
+/* 000005BC */ 0x000005B0,
+/* 000005C0 */ 0x002F2A02,
+/* 000005C4 */ 0x00002037,
+/* 000005C8 */ 0x000005C0,
+/* 000005CC */ 0x43495004,
+/* 000005D0 */ 0x0000004B,
+/* 000005D4 */ 0x00002038,
+/* 000005D8 */ 0x000005CC,
+/* 000005DC */ 0x00212B02,
+/* 000005E0 */ 0x00002039,
+/* 000005E4 */ 0x000005DC,
+/* 000005E8 */ 0x00213202,
+/* 000005EC */ 0x0000203A,
+/* 000005F0 */ 0x000005E8,
+/* 000005F4 */ 0x00403202,
+/* 000005F8 */ 0x0000203B,
+/* 000005FC */ 0x000005F4,
+/* 00000600 */ 0x554F4305,
+/* 00000604 */ 0x0000544E,
+/* 00000608 */ 0x0000203C,
+/* 0000060C */ 0x00000600,
+/* 00000610 */ 0x58414D03,
+/* 00000614 */ 0x0000203E,
+/* 00000618 */ 0x00000610,
+/* 0000061C */ 0x4E494D03,
+/* 00000620 */ 0x0000203F,
+/* 00000624 */ 0x0000061C,
+/* 00000628 */ 0x004C4202,
+/* 0000062C */ 0x00002004,
+/* 00000630 */ 0x00000020,
+/* 00000634 */ 0x00000628,
+/* 00000638 */ 0x4C454304,
+/* 0000063C */ 0x0000004C,
+/* 00000640 */ 0x00002004,
+/* 00000644 */ 0x00000004,
+/* 00000648 */ 0x00000638,
+/* 0000064C */ 0x4C454305,
+/* 00000650 */ 0x00002B4C,
+/* 00000654 */ 0x00202504,
+/* 00000658 */ 0x00000004,
+/* 0000065C */ 0x0000064C,
+/* 00000660 */ 0x4C454305,
+/* 00000664 */ 0x00002D4C,
+/* 00000668 */ 0x00202904,
+/* 0000066C */ 0x00000004,
+/* 00000670 */ 0x00000660,
+/* 00000674 */ 0x4C454305,
+/* 00000678 */ 0x0000534C,
+/* 0000067C */ 0x00203404,
+/* 00000680 */ 0x00000004,
+/* 00000684 */ 0x00000674,
+/* 00000688 */ 0x4C454305,
+/* 0000068C */ 0x00002F4C,
+/* 00000690 */ 0x00203204,
+/* 00000694 */ 0x00000004,
+/* 00000698 */ 0x00000688,
+/* 0000069C */ 0x002B3102,
+/* 000006A0 */ 0x00202504,
+/* 000006A4 */ 0x00000001,
+/* 000006A8 */ 0x0000069C,
+/* 000006AC */ 0x002D3102,
+/* 000006B0 */ 0x00202904,
+/* 000006B4 */ 0x00000001,
+/* 000006B8 */ 0x000006AC,
+/* 000006BC */ 0x002B3202,
+/* 000006C0 */ 0x00202504,
+/* 000006C4 */ 0x00000002,
+/* 000006C8 */ 0x000006BC,
+/* 000006CC */ 0x002D3202,
+/* 000006D0 */ 0x00202904,
+/* 000006D4 */ 0x00000002,
+/* 000006D8 */ 0x000006CC,
+/* 000006DC */ 0x002A3202,
+/* 000006E0 */ 0x00203404,
+/* 000006E4 */ 0x00000002,
+/* 000006E8 */ 0x000006DC,
+/* 000006EC */ 0x002F3202,
+/* 000006F0 */ 0x00203204,
+/* 000006F4 */ 0x00000002,
+/* 000006F8 */ 0x000006EC,
+/* 000006FC */ 0x6E65730A,
+/* 00000700 */ 0x63615064,
+/* 00000704 */ 0x0074656B,
+/* 00000708 */ 0x00002041,
+/* 0000070C */ 0x000006FC,
+/* 00000710 */ 0x4B4F5004,
+/* 00000714 */ 0x00000045,
+/* 00000718 */ 0x00002042,
+/* 0000071C */ 0x00000710,
+/* 00000720 */ 0x45455004,
+/* 00000724 */ 0x0000004B,
+/* 00000728 */ 0x00002043,
+/* 0000072C */ 0x00000720,
+/* 00000730 */ 0x43444103,
+/* 00000734 */ 0x00002044,
+/* 00000738 */ 0x00000730,
+/* 0000073C */ 0x4E495003,
+/* 00000740 */ 0x00002045,
+/* 00000744 */ 0x0000073C,
+/* 00000748 */ 0x4E4F5404,
+/* 0000074C */ 0x00000045,
+/* 00000750 */ 0x00002040,
+/* 00000754 */ 0x00000748,
+/* 00000758 */ 0x54554404,
+/* 0000075C */ 0x00000059,
+/* 00000760 */ 0x00002046,
+/* 00000764 */ 0x00000758,
+/* 00000768 */ 0x45524604,
+/* 0000076C */ 0x00000051,
+/* 00000770 */ 0x00002047,
+/* 00000774 */ 0x00000768,
+/* 00000778 */ 0x59454B03,
+/* 0000077C */ 0x00000006,
+/* 00000780 */ 0x00000340,
+/* 00000784 */ 0x000003B0,
+/* 00000788 */ 0x00000780,
+/* 0000078C */ 0x00000380,
+/* 00000790 */ 0x00000778,
+/* 00000794 */ 0x54495706,
+/* 00000798 */ 0x004E4948,
+/* 0000079C */ 0x00000006,
+/* 000007A0 */ 0x00000450,
+/* 000007A4 */ 0x0000050C,
+/* 000007A8 */ 0x00000414,
+/* 000007AC */ 0x0000050C,
+/* 000007B0 */ 0x000003FC,
+/* 000007B4 */ 0x00000530,
+/* 000007B8 */ 0x00000380,
+/* 000007BC */ 0x00000794,
+/* 000007C0 */ 0x48433E05,
+/* 000007C4 */ 0x00005241,
+/* 000007C8 */ 0x00000006,
+/* 000007CC */ 0x00000360,
+/* 000007D0 */ 0x0000007F,
+/* 000007D4 */ 0x00000468,
+/* 000007D8 */ 0x00000430,
+/* 000007DC */ 0x00000360,
+/* 000007E0 */ 0x0000007F,
+/* 000007E4 */ 0x0000062C,
+/* 000007E8 */ 0x0000079C,
+/* 000007EC */ 0x000003B0,
+/* 000007F0 */ 0x00000800,
+/* 000007F4 */ 0x00000424,
+/* 000007F8 */ 0x00000360,
+/* 000007FC */ 0x0000005F,
+/* 00000800 */ 0x00000380,
+/* 00000804 */ 0x000007C0,
+/* 00000808 */ 0x494C4107,
+/* 0000080C */ 0x44454E47,
+/* 00000810 */ 0x00000006,
+/* 00000814 */ 0x00000360,
+/* 00000818 */ 0x00000003,
+/* 0000081C */ 0x000004D4,
+/* 00000820 */ 0x00000360,
+/* 00000824 */ 0xFFFFFFFC,
+/* 00000828 */ 0x00000468,
+/* 0000082C */ 0x00000380,
+/* 00000830 */ 0x00000808,
+/* 00000834 */ 0x52454804,
+/* 00000838 */ 0x00000045,
+/* 0000083C */ 0x00000006,
+/* 00000840 */ 0x0000028C,
+/* 00000844 */ 0x000003D8,
+/* 00000848 */ 0x00000380,
+/* 0000084C */ 0x00000834,
+/* 00000850 */ 0x44415003,
+/* 00000854 */ 0x00000006,
+/* 00000858 */ 0x0000083C,
+/* 0000085C */ 0x00000360,
+/* 00000860 */ 0x00000050,
+/* 00000864 */ 0x000004D4,
+/* 00000868 */ 0x00000380,
+/* 0000086C */ 0x00000850,
+/* 00000870 */ 0x42495403,
+/* 00000874 */ 0x00000006,
+/* 00000878 */ 0x00000254,
+/* 0000087C */ 0x000003D8,
+/* 00000880 */ 0x00000380,
+/* 00000884 */ 0x00000870,
+/* 00000888 */ 0x58454008,
+/* 0000088C */ 0x54554345,
+/* 00000890 */ 0x00000045,
+/* 00000894 */ 0x00000006,
+/* 00000898 */ 0x000003D8,
+/* 0000089C */ 0x0000049C,
+/* 000008A0 */ 0x000003B0,
+/* 000008A4 */ 0x000008AC,
+/* 000008A8 */ 0x00000390,
+/* 000008AC */ 0x00000380,
+/* 000008B0 */ 0x00000888,
+/* 000008B4 */ 0x4F4D4305,
+/* 000008B8 */ 0x00004556,
+/* 000008BC */ 0x00000006,
+/* 000008C0 */ 0x00000414,
+/* 000008C4 */ 0x000003C0,
+/* 000008C8 */ 0x000008EC,
+/* 000008CC */ 0x00000450,
+/* 000008D0 */ 0x000003F0,
+/* 000008D4 */ 0x00000450,
+/* 000008D8 */ 0x000003E4,
+/* 000008DC */ 0x00000414,
+/* 000008E0 */ 0x000006A0,
+/* 000008E4 */ 0x000003FC,
+/* 000008E8 */ 0x000006A0,
+/* 000008EC */ 0x000003A0,
+/* 000008F0 */ 0x000008CC,
+/* 000008F4 */ 0x000004B8,
+/* 000008F8 */ 0x00000380,
+/* 000008FC */ 0x000008B4,
+/* 00000900 */ 0x564F4D04,
+/* 00000904 */ 0x00000045,
+/* 00000908 */ 0x00000006,
+/* 0000090C */ 0x00000690,
+/* 00000910 */ 0x00000414,
+/* 00000914 */ 0x000003C0,
+/* 00000918 */ 0x0000093C,
+/* 0000091C */ 0x00000450,
+/* 00000920 */ 0x000003D8,
+/* 00000924 */ 0x00000450,
+/* 00000928 */ 0x000003CC,
+/* 0000092C */ 0x00000414,
+/* 00000930 */ 0x00000654,
+/* 00000934 */ 0x000003FC,
+/* 00000938 */ 0x00000654,
+/* 0000093C */ 0x000003A0,
+/* 00000940 */ 0x0000091C,
+/* 00000944 */ 0x000004B8,
+/* 00000948 */ 0x00000380,
+/* 0000094C */ 0x00000900,
+/* 00000950 */ 0x4C494604,
+/* 00000954 */ 0x0000004C,
+/* 00000958 */ 0x00000006,
+/* 0000095C */ 0x00000440,
+/* 00000960 */ 0x00000414,
+/* 00000964 */ 0x00000440,
+/* 00000968 */ 0x000003C0,
+/* 0000096C */ 0x0000097C,
+/* 00000970 */ 0x000004C8,
+/* 00000974 */ 0x000003E4,
+/* 00000978 */ 0x000006A0,
+/* 0000097C */ 0x000003A0,
+/* 00000980 */ 0x00000970,
+/* 00000984 */ 0x000004B8,
+/* 00000988 */ 0x00000380,
+/* 0000098C */ 0x00000950,
+/* 00000990 */ 0x47494405,
+/* 00000994 */ 0x00005449,
+/* 00000998 */ 0x00000006,
+/* 0000099C */ 0x00000360,
+/* 000009A0 */ 0x00000009,
+/* 000009A4 */ 0x00000450,
+/* 000009A8 */ 0x0000053C,
+/* 000009AC */ 0x00000360,
+/* 000009B0 */ 0x00000007,
+/* 000009B4 */ 0x00000468,
+/* 000009B8 */ 0x000004D4,
+/* 000009BC */ 0x00000360,
+/* 000009C0 */ 0x00000030,
+/* 000009C4 */ 0x000004D4,
+/* 000009C8 */ 0x00000380,
+/* 000009CC */ 0x00000990,
+/* 000009D0 */ 0x54584507,
+/* 000009D4 */ 0x54434152,
+/* 000009D8 */ 0x00000006,
+/* 000009DC */ 0x00000360,
+/* 000009E0 */ 0x00000000,
+/* 000009E4 */ 0x00000440,
+/* 000009E8 */ 0x0000054C,
+/* 000009EC */ 0x00000440,
+/* 000009F0 */ 0x00000998,
+/* 000009F4 */ 0x00000380,
+/* 000009F8 */ 0x000009D0,
+/* 000009FC */ 0x00233C02,
+/* 00000A00 */ 0x00000006,
+/* 00000A04 */ 0x00000854,
+/* 00000A08 */ 0x00000208,
+/* 00000A0C */ 0x000003CC,
+/* 00000A10 */ 0x00000380,
+/* 00000A14 */ 0x000009FC,
+/* 00000A18 */ 0x4C4F4804,
+/* 00000A1C */ 0x00000044,
+/* 00000A20 */ 0x00000006,
+/* 00000A24 */ 0x00000208,
+/* 00000A28 */ 0x000003D8,
+/* 00000A2C */ 0x000006B0,
+/* 00000A30 */ 0x00000430,
+/* 00000A34 */ 0x00000208,
+/* 00000A38 */ 0x000003CC,
+/* 00000A3C */ 0x000003E4,
+/* 00000A40 */ 0x00000380,
+/* 00000A44 */ 0x00000A18,
+/* 00000A48 */ 0x00002301,
+/* 00000A4C */ 0x00000006,
+/* 00000A50 */ 0x00000268,
+/* 00000A54 */ 0x000003D8,
+/* 00000A58 */ 0x000009D8,
+/* 00000A5C */ 0x00000A20,
+/* 00000A60 */ 0x00000380,
+/* 00000A64 */ 0x00000A48,
+/* 00000A68 */ 0x00532302,
+/* 00000A6C */ 0x00000006,
+/* 00000A70 */ 0x00000A4C,
+/* 00000A74 */ 0x00000430,
+/* 00000A78 */ 0x000003B0,
+/* 00000A7C */ 0x00000A88,
+/* 00000A80 */ 0x000003C0,
+/* 00000A84 */ 0x00000A70,
+/* 00000A88 */ 0x00000380,
+/* 00000A8C */ 0x00000A68,
+/* 00000A90 */ 0x47495304,
+/* 00000A94 */ 0x0000004E,
+/* 00000A98 */ 0x00000006,
+/* 00000A9C */ 0x0000045C,
+/* 00000AA0 */ 0x000003B0,
+/* 00000AA4 */ 0x00000AB4,
+/* 00000AA8 */ 0x00000360,
+/* 00000AAC */ 0x0000002D,
+/* 00000AB0 */ 0x00000A20,
+/* 00000AB4 */ 0x00000380,
+/* 00000AB8 */ 0x00000A90,
+/* 00000ABC */ 0x003E2302,
+/* 00000AC0 */ 0x00000006,
+/* 00000AC4 */ 0x00000424,
+/* 00000AC8 */ 0x00000208,
+/* 00000ACC */ 0x000003D8,
+/* 00000AD0 */ 0x00000854,
+/* 00000AD4 */ 0x00000450,
+/* 00000AD8 */ 0x0000050C,
+/* 00000ADC */ 0x00000380,
+/* 00000AE0 */ 0x00000ABC,
+/* 00000AE4 */ 0x72747303,
+/* 00000AE8 */ 0x00000006,
+/* 00000AEC */ 0x00000430,
+/* 00000AF0 */ 0x00000414,
+/* 00000AF4 */ 0x00000518,
+/* 00000AF8 */ 0x00000A00,
+/* 00000AFC */ 0x00000A6C,
+/* 00000B00 */ 0x000003FC,
+/* 00000B04 */ 0x00000A98,
+/* 00000B08 */ 0x00000AC0,
+/* 00000B0C */ 0x00000380,
+/* 00000B10 */ 0x00000AE4,
+/* 00000B14 */ 0x58454803,
+/* 00000B18 */ 0x00000006,
+/* 00000B1C */ 0x00000360,
+/* 00000B20 */ 0x00000010,
+/* 00000B24 */ 0x00000268,
+/* 00000B28 */ 0x000003CC,
+/* 00000B2C */ 0x00000380,
+/* 00000B30 */ 0x00000B14,
+/* 00000B34 */ 0x43454407,
+/* 00000B38 */ 0x4C414D49,
+/* 00000B3C */ 0x00000006,
+/* 00000B40 */ 0x00000360,
+/* 00000B44 */ 0x0000000A,
+/* 00000B48 */ 0x00000268,
+/* 00000B4C */ 0x000003CC,
+/* 00000B50 */ 0x00000380,
+/* 00000B54 */ 0x00000B34,
+/* 00000B58 */ 0x70757706,
+/* 00000B5C */ 0x00726570,
+/* 00000B60 */ 0x00000006,
+/* 00000B64 */ 0x00000360,
+/* 00000B68 */ 0x5F5F5F5F,
+/* 00000B6C */ 0x00000468,
+/* 00000B70 */ 0x00000380,
+/* 00000B74 */ 0x00000B58,
+/* 00000B78 */ 0x70753E06,
+/* 00000B7C */ 0x00726570,
+/* 00000B80 */ 0x00000006,
+/* 00000B84 */ 0x00000430,
+/* 00000B88 */ 0x00000360,
+/* 00000B8C */ 0x00000061,
+/* 00000B90 */ 0x00000360,
+/* 00000B94 */ 0x0000007B,
+/* 00000B98 */ 0x0000079C,
+/* 00000B9C */ 0x000003B0,
+/* 00000BA0 */ 0x00000BB0,
+/* 00000BA4 */ 0x00000360,
+/* 00000BA8 */ 0x0000005F,
+/* 00000BAC */ 0x00000468,
+/* 00000BB0 */ 0x00000380,
+/* 00000BB4 */ 0x00000B78,
+/* 00000BB8 */ 0x47494406,
+/* 00000BBC */ 0x003F5449,
+/* 00000BC0 */ 0x00000006,
+/* 00000BC4 */ 0x00000414,
+/* 00000BC8 */ 0x00000B80,
+/* 00000BCC */ 0x00000360,
+/* 00000BD0 */ 0x00000030,
+/* 00000BD4 */ 0x0000050C,
+/* 00000BD8 */ 0x00000360,
+/* 00000BDC */ 0x00000009,
+/* 00000BE0 */ 0x00000450,
+/* 00000BE4 */ 0x0000053C,
+/* 00000BE8 */ 0x000003B0,
+/* 00000BEC */ 0x00000C10,
+/* 00000BF0 */ 0x00000360,
+/* 00000BF4 */ 0x00000007,
+/* 00000BF8 */ 0x0000050C,
+/* 00000BFC */ 0x00000430,
+/* 00000C00 */ 0x00000360,
+/* 00000C04 */ 0x0000000A,
+/* 00000C08 */ 0x0000053C,
+/* 00000C0C */ 0x00000474,
+/* 00000C10 */ 0x00000430,
+/* 00000C14 */ 0x000003FC,
+/* 00000C18 */ 0x00000530,
+/* 00000C1C */ 0x00000380,
+/* 00000C20 */ 0x00000BB8,
+/* 00000C24 */ 0x4D554E07,
+/* 00000C28 */ 0x3F524542,
+/* 00000C2C */ 0x00000006,
+/* 00000C30 */ 0x00000268,
+/* 00000C34 */ 0x000003D8,
+/* 00000C38 */ 0x00000414,
+/* 00000C3C */ 0x00000360,
+/* 00000C40 */ 0x00000000,
+/* 00000C44 */ 0x00000450,
+/* 00000C48 */ 0x00000608,
+/* 00000C4C */ 0x00000450,
+/* 00000C50 */ 0x000003F0,
+/* 00000C54 */ 0x00000360,
+/* 00000C58 */ 0x00000024,
+/* 00000C5C */ 0x00000524,
+/* 00000C60 */ 0x000003B0,
+/* 00000C64 */ 0x00000C7C,
+/* 00000C68 */ 0x00000B18,
+/* 00000C6C */ 0x00000440,
+/* 00000C70 */ 0x000006A0,
+/* 00000C74 */ 0x00000440,
+/* 00000C78 */ 0x000006B0,
+/* 00000C7C */ 0x00000450,
+/* 00000C80 */ 0x000003F0,
+/* 00000C84 */ 0x00000360,
+/* 00000C88 */ 0x0000002D,
+/* 00000C8C */ 0x00000524,
+/* 00000C90 */ 0x00000414,
+/* 00000C94 */ 0x00000440,
+/* 00000C98 */ 0x00000408,
+/* 00000C9C */ 0x0000050C,
+/* 00000CA0 */ 0x00000440,
+/* 00000CA4 */ 0x00000408,
+/* 00000CA8 */ 0x000004D4,
+/* 00000CAC */ 0x0000049C,
+/* 00000CB0 */ 0x000003B0,
+/* 00000CB4 */ 0x00000D40,
+/* 00000CB8 */ 0x000006B0,
+/* 00000CBC */ 0x00000414,
+/* 00000CC0 */ 0x00000430,
+/* 00000CC4 */ 0x00000414,
+/* 00000CC8 */ 0x000003F0,
+/* 00000CCC */ 0x00000268,
+/* 00000CD0 */ 0x000003D8,
+/* 00000CD4 */ 0x00000BC0,
+/* 00000CD8 */ 0x000003B0,
+/* 00000CDC */ 0x00000D24,
+/* 00000CE0 */ 0x00000440,
+/* 00000CE4 */ 0x00000268,
+/* 00000CE8 */ 0x000003D8,
+/* 00000CEC */ 0x0000059C,
+/* 00000CF0 */ 0x000004D4,
+/* 00000CF4 */ 0x000003FC,
+/* 00000CF8 */ 0x000006A0,
+/* 00000CFC */ 0x000003A0,
+/* 00000D00 */ 0x00000CC0,
+/* 00000D04 */ 0x00000424,
+/* 00000D08 */ 0x00000408,
+/* 00000D0C */ 0x000003B0,
+/* 00000D10 */ 0x00000D18,
+/* 00000D14 */ 0x000004F0,
+/* 00000D18 */ 0x00000440,
+/* 00000D1C */ 0x000003C0,
+/* 00000D20 */ 0x00000D3C,
+/* 00000D24 */ 0x000003FC,
+/* 00000D28 */ 0x000003FC,
+/* 00000D2C */ 0x000004B8,
+/* 00000D30 */ 0x000004B8,
+/* 00000D34 */ 0x00000360,
+/* 00000D38 */ 0x00000000,
+/* 00000D3C */ 0x00000430,
+/* 00000D40 */ 0x000003FC,
+/* 00000D44 */ 0x000004B8,
+/* 00000D48 */ 0x000003FC,
+/* 00000D4C */ 0x00000268,
+/* 00000D50 */ 0x000003CC,
+/* 00000D54 */ 0x00000380,
+/* 00000D58 */ 0x00000C24,
+/* 00000D5C */ 0x41505305,
+/* 00000D60 */ 0x00004543,
+/* 00000D64 */ 0x00000006,
+/* 00000D68 */ 0x0000062C,
+/* 00000D6C */ 0x00000350,
+/* 00000D70 */ 0x00000380,
+/* 00000D74 */ 0x00000D5C,
+/* 00000D78 */ 0x41484305,
+/* 00000D7C */ 0x00005352,
+/* 00000D80 */ 0x00000006,
+/* 00000D84 */ 0x00000440,
+/* 00000D88 */ 0x00000360,
+/* 00000D8C */ 0x00000000,
+/* 00000D90 */ 0x00000614,
+/* 00000D94 */ 0x00000414,
+/* 00000D98 */ 0x000003C0,
+/* 00000D9C */ 0x00000DA8,
+/* 00000DA0 */ 0x00000430,
+/* 00000DA4 */ 0x00000350,
+/* 00000DA8 */ 0x000003A0,
+/* 00000DAC */ 0x00000DA0,
+/* 00000DB0 */ 0x00000424,
+/* 00000DB4 */ 0x00000380,
+/* 00000DB8 */ 0x00000D78,
+/* 00000DBC */ 0x41505306,
+/* 00000DC0 */ 0x00534543,
+/* 00000DC4 */ 0x00000006,
+/* 00000DC8 */ 0x0000062C,
+/* 00000DCC */ 0x00000D80,
+/* 00000DD0 */ 0x00000380,
+/* 00000DD4 */ 0x00000DBC,
+/* 00000DD8 */ 0x50595404,
+/* 00000DDC */ 0x00000045,
+/* 00000DE0 */ 0x00000006,
+/* 00000DE4 */ 0x00000414,
+/* 00000DE8 */ 0x000003C0,
+/* 00000DEC */ 0x00000E04,
+/* 00000DF0 */ 0x00000430,
+/* 00000DF4 */ 0x000003F0,
+/* 00000DF8 */ 0x000007C8,
+/* 00000DFC */ 0x00000350,
+/* 00000E00 */ 0x000006A0,
+/* 00000E04 */ 0x000003A0,
+/* 00000E08 */ 0x00000DF0,
+/* 00000E0C */ 0x00000424,
+/* 00000E10 */ 0x00000380,
+/* 00000E14 */ 0x00000DD8,
+/* 00000E18 */ 0x00524302,
+/* 00000E1C */ 0x00000006,
+/* 00000E20 */ 0x00000360,
+/* 00000E24 */ 0x0000000A,
+/* 00000E28 */ 0x00000360,
+/* 00000E2C */ 0x0000000D,
+/* 00000E30 */ 0x00000350,
+/* 00000E34 */ 0x00000350,
+/* 00000E38 */ 0x00000380,
+/* 00000E3C */ 0x00000E18,
+/* 00000E40 */ 0x246F6403,
+/* 00000E44 */ 0x00000006,
+/* 00000E48 */ 0x000003FC,
+/* 00000E4C */ 0x00000408,
+/* 00000E50 */ 0x000003FC,
+/* 00000E54 */ 0x00000608,
+/* 00000E58 */ 0x000004D4,
+/* 00000E5C */ 0x00000810,
+/* 00000E60 */ 0x00000414,
+/* 00000E64 */ 0x00000440,
+/* 00000E68 */ 0x00000414,
+/* 00000E6C */ 0x00000380,
+/* 00000E70 */ 0x00000E40,
+/* 00000E74 */ 0x7C222403,
+/* 00000E78 */ 0x00000006,
+/* 00000E7C */ 0x00000E44,
+/* 00000E80 */ 0x00000380,
+/* 00000E84 */ 0x00000E74,
+/* 00000E88 */ 0x7C222E03,
+/* 00000E8C */ 0x00000006,
+/* 00000E90 */ 0x00000E44,
+/* 00000E94 */ 0x00000608,
+/* 00000E98 */ 0x00000DE0,
+/* 00000E9C */ 0x00000380,
+/* 00000EA0 */ 0x00000E88,
+/* 00000EA4 */ 0x00522E02,
+/* 00000EA8 */ 0x00000006,
+/* 00000EAC */ 0x00000414,
+/* 00000EB0 */ 0x00000AE8,
+/* 00000EB4 */ 0x000003FC,
+/* 00000EB8 */ 0x00000450,
+/* 00000EBC */ 0x0000050C,
+/* 00000EC0 */ 0x00000DC4,
+/* 00000EC4 */ 0x00000DE0,
+/* 00000EC8 */ 0x00000380,
+/* 00000ECC */ 0x00000EA4,
+/* 00000ED0 */ 0x522E5503,
+/* 00000ED4 */ 0x00000006,
+/* 00000ED8 */ 0x00000414,
+/* 00000EDC */ 0x00000A00,
+/* 00000EE0 */ 0x00000A6C,
+/* 00000EE4 */ 0x00000AC0,
+/* 00000EE8 */ 0x000003FC,
+/* 00000EEC */ 0x00000450,
+/* 00000EF0 */ 0x0000050C,
+/* 00000EF4 */ 0x00000DC4,
+/* 00000EF8 */ 0x00000DE0,
+/* 00000EFC */ 0x00000380,
+/* 00000F00 */ 0x00000ED0,
+/* 00000F04 */ 0x002E5502,
+/* 00000F08 */ 0x00000006,
+/* 00000F0C */ 0x00000A00,
+/* 00000F10 */ 0x00000A6C,
+/* 00000F14 */ 0x00000AC0,
+/* 00000F18 */ 0x00000D64,
+/* 00000F1C */ 0x00000DE0,
+/* 00000F20 */ 0x00000380,
+/* 00000F24 */ 0x00000F04,
+/* 00000F28 */ 0x00002E01,
+/* 00000F2C */ 0x00000006,
+/* 00000F30 */ 0x00000268,
+/* 00000F34 */ 0x000003D8,
+/* 00000F38 */ 0x00000360,
+/* 00000F3C */ 0x0000000A,
+/* 00000F40 */ 0x00000480,
+/* 00000F44 */ 0x000003B0,
+/* 00000F48 */ 0x00000F58,
+/* 00000F4C */ 0x00000F08,
+/* 00000F50 */ 0x00000380,
+/* 00000F54 */ 0x00000F40,
+/* 00000F58 */ 0x00000AE8,
+/* 00000F5C */ 0x00000D64,
+/* 00000F60 */ 0x00000DE0,
+/* 00000F64 */ 0x00000380,
+/* 00000F68 */ 0x00000F28,
+/* 00000F6C */ 0x00003F01,
+/* 00000F70 */ 0x00000006,
+/* 00000F74 */ 0x000003D8,
+/* 00000F78 */ 0x00000F2C,
+/* 00000F7C */ 0x00000380,
+/* 00000F80 */ 0x00000F6C,
+/* 00000F84 */ 0x61702807,
+/* 00000F88 */ 0x29657372,
+/* 00000F8C */ 0x00000006,
+/* 00000F90 */ 0x000002D8,
+/* 00000F94 */ 0x000003E4,
+/* 00000F98 */ 0x00000450,
+/* 00000F9C */ 0x00000414,
+/* 00000FA0 */ 0x00000430,
+/* 00000FA4 */ 0x000003B0,
+/* 00000FA8 */ 0x000010A0,
+/* 00000FAC */ 0x000006B0,
+/* 00000FB0 */ 0x000002D8,
+/* 00000FB4 */ 0x000003F0,
+/* 00000FB8 */ 0x0000062C,
+/* 00000FBC */ 0x00000524,
+/* 00000FC0 */ 0x000003B0,
+/* 00000FC4 */ 0x00001014,
+/* 00000FC8 */ 0x00000414,
+/* 00000FCC */ 0x0000062C,
+/* 00000FD0 */ 0x00000450,
+/* 00000FD4 */ 0x000003F0,
+/* 00000FD8 */ 0x0000050C,
+/* 00000FDC */ 0x0000045C,
+/* 00000FE0 */ 0x000004E0,
+/* 00000FE4 */ 0x000003B0,
+/* 00000FE8 */ 0x00001010,
+/* 00000FEC */ 0x000006A0,
+/* 00000FF0 */ 0x000003A0,
+/* 00000FF4 */ 0x00000FCC,
+/* 00000FF8 */ 0x000003FC,
+/* 00000FFC */ 0x00000424,
+/* 00001000 */ 0x00000360,
+/* 00001004 */ 0x00000000,
+/* 00001008 */ 0x00000430,
+/* 0000100C */ 0x00000380,
+/* 00001010 */ 0x000003FC,
+/* 00001014 */ 0x00000450,
+/* 00001018 */ 0x00000440,
+/* 0000101C */ 0x00000414,
+/* 00001020 */ 0x000002D8,
+/* 00001024 */ 0x000003F0,
+/* 00001028 */ 0x00000450,
+/* 0000102C */ 0x000003F0,
+/* 00001030 */ 0x0000050C,
+/* 00001034 */ 0x000002D8,
+/* 00001038 */ 0x000003F0,
+/* 0000103C */ 0x0000062C,
+/* 00001040 */ 0x00000524,
+/* 00001044 */ 0x000003B0,
+/* 00001048 */ 0x00001050,
+/* 0000104C */ 0x0000045C,
+/* 00001050 */ 0x000003B0,
+/* 00001054 */ 0x00001074,
+/* 00001058 */ 0x000006A0,
+/* 0000105C */ 0x000003A0,
+/* 00001060 */ 0x00001020,
+/* 00001064 */ 0x00000430,
+/* 00001068 */ 0x00000414,
+/* 0000106C */ 0x000003C0,
+/* 00001070 */ 0x00001088,
+/* 00001074 */ 0x000003FC,
+/* 00001078 */ 0x00000424,
+/* 0000107C */ 0x00000430,
+/* 00001080 */ 0x000006A0,
+/* 00001084 */ 0x00000414,
+/* 00001088 */ 0x00000450,
+/* 0000108C */ 0x0000050C,
+/* 00001090 */ 0x000003FC,
+/* 00001094 */ 0x000003FC,
+/* 00001098 */ 0x0000050C,
+/* 0000109C */ 0x00000380,
+/* 000010A0 */ 0x00000450,
+/* 000010A4 */ 0x000003FC,
+/* 000010A8 */ 0x0000050C,
+/* 000010AC */ 0x00000380,
+/* 000010B0 */ 0x00000F84,
+/* 000010B4 */ 0x43415005,
+/* 000010B8 */ 0x0000244B,
+/* 000010BC */ 0x00000006,
+/* 000010C0 */ 0x00000430,
+/* 000010C4 */ 0x00000414,
+/* 000010C8 */ 0x000004C8,
+/* 000010CC */ 0x000004D4,
+/* 000010D0 */ 0x00000360,
+/* 000010D4 */ 0xFFFFFFFC,
+/* 000010D8 */ 0x00000468,
+/* 000010DC */ 0x00000360,
+/* 000010E0 */ 0x00000000,
+/* 000010E4 */ 0x00000440,
+/* 000010E8 */ 0x000003CC,
+/* 000010EC */ 0x000004C8,
+/* 000010F0 */ 0x000003E4,
+/* 000010F4 */ 0x000006A0,
+/* 000010F8 */ 0x00000440,
+/* 000010FC */ 0x000008BC,
+/* 00001100 */ 0x000003FC,
+/* 00001104 */ 0x00000380,
+/* 00001108 */ 0x000010B4,
+/* 0000110C */ 0x52415005,
+/* 00001110 */ 0x00004553,
+/* 00001114 */ 0x00000006,
+/* 00001118 */ 0x00000414,
+/* 0000111C */ 0x00000874,
+/* 00001120 */ 0x0000022C,
+/* 00001124 */ 0x000003D8,
+/* 00001128 */ 0x000004D4,
+/* 0000112C */ 0x00000240,
+/* 00001130 */ 0x000003D8,
+/* 00001134 */ 0x0000022C,
+/* 00001138 */ 0x000003D8,
+/* 0000113C */ 0x0000050C,
+/* 00001140 */ 0x000003FC,
+/* 00001144 */ 0x00000F8C,
+/* 00001148 */ 0x0000022C,
+/* 0000114C */ 0x000005E0,
+/* 00001150 */ 0x00000380,
+/* 00001154 */ 0x0000110C,
+/* 00001158 */ 0x4B4F5405,
+/* 0000115C */ 0x00004E45,
+/* 00001160 */ 0x00000006,
+/* 00001164 */ 0x0000062C,
+/* 00001168 */ 0x00001114,
+/* 0000116C */ 0x00000360,
+/* 00001170 */ 0x0000001F,
+/* 00001174 */ 0x00000620,
+/* 00001178 */ 0x0000083C,
+/* 0000117C */ 0x00000654,
+/* 00001180 */ 0x000010BC,
+/* 00001184 */ 0x00000380,
+/* 00001188 */ 0x00001158,
+/* 0000118C */ 0x524F5704,
+/* 00001190 */ 0x00000044,
+/* 00001194 */ 0x00000006,
+/* 00001198 */ 0x00001114,
+/* 0000119C */ 0x0000083C,
+/* 000011A0 */ 0x00000654,
+/* 000011A4 */ 0x000010BC,
+/* 000011A8 */ 0x00000380,
+/* 000011AC */ 0x0000118C,
+/* 000011B0 */ 0x4D414E05,
+/* 000011B4 */ 0x00003E45,
+/* 000011B8 */ 0x00000006,
+/* 000011BC */ 0x00000608,
+/* 000011C0 */ 0x00000360,
+/* 000011C4 */ 0x0000001F,
+/* 000011C8 */ 0x00000468,
+/* 000011CC */ 0x000004D4,
+/* 000011D0 */ 0x00000810,
+/* 000011D4 */ 0x00000380,
+/* 000011D8 */ 0x000011B0,
+/* 000011DC */ 0x4D415305,
+/* 000011E0 */ 0x00003F45,
+/* 000011E4 */ 0x00000006,
+/* 000011E8 */ 0x00000360,
+/* 000011EC */ 0x0000001F,
+/* 000011F0 */ 0x00000468,
+/* 000011F4 */ 0x00000690,
+/* 000011F8 */ 0x00000414,
+/* 000011FC */ 0x000003C0,
+/* 00001200 */ 0x00001260,
+/* 00001204 */ 0x00000450,
+/* 00001208 */ 0x00000408,
+/* 0000120C */ 0x00000360,
+/* 00001210 */ 0x00000004,
+/* 00001214 */ 0x0000059C,
+/* 00001218 */ 0x000004D4,
+/* 0000121C */ 0x000003D8,
+/* 00001220 */ 0x00000B60,
+/* 00001224 */ 0x00000450,
+/* 00001228 */ 0x00000408,
+/* 0000122C */ 0x00000360,
+/* 00001230 */ 0x00000004,
+/* 00001234 */ 0x0000059C,
+/* 00001238 */ 0x000004D4,
+/* 0000123C */ 0x000003D8,
+/* 00001240 */ 0x00000B60,
+/* 00001244 */ 0x0000050C,
+/* 00001248 */ 0x0000049C,
+/* 0000124C */ 0x000003B0,
+/* 00001250 */ 0x00001260,
+/* 00001254 */ 0x000003FC,
+/* 00001258 */ 0x00000424,
+/* 0000125C */ 0x00000380,
+/* 00001260 */ 0x000003A0,
+/* 00001264 */ 0x00001204,
+/* 00001268 */ 0x00000360,
+/* 0000126C */ 0x00000000,
+/* 00001270 */ 0x00000380,
+/* 00001274 */ 0x000011DC,
+/* 00001278 */ 0x6E696604,
+/* 0000127C */ 0x00000064,
+/* 00001280 */ 0x00000006,
+/* 00001284 */ 0x00000440,
+/* 00001288 */ 0x00000430,
+/* 0000128C */ 0x000003D8,
+/* 00001290 */ 0x000002D8,
+/* 00001294 */ 0x000003CC,
+/* 00001298 */ 0x00000430,
+/* 0000129C */ 0x000003D8,
+/* 000012A0 */ 0x00000414,
+/* 000012A4 */ 0x00000654,
+/* 000012A8 */ 0x00000440,
+/* 000012AC */ 0x000003D8,
+/* 000012B0 */ 0x00000430,
+/* 000012B4 */ 0x000003B0,
+/* 000012B8 */ 0x00001314,
+/* 000012BC */ 0x00000430,
+/* 000012C0 */ 0x000003D8,
+/* 000012C4 */ 0x00000360,
+/* 000012C8 */ 0xFFFFFF3F,
+/* 000012CC */ 0x00000468,
+/* 000012D0 */ 0x00000B60,
+/* 000012D4 */ 0x00000408,
+/* 000012D8 */ 0x00000B60,
+/* 000012DC */ 0x00000480,
+/* 000012E0 */ 0x000003B0,
+/* 000012E4 */ 0x000012FC,
+/* 000012E8 */ 0x00000654,
+/* 000012EC */ 0x00000360,
+/* 000012F0 */ 0xFFFFFFFF,
+/* 000012F4 */ 0x000003C0,
+/* 000012F8 */ 0x0000130C,
+/* 000012FC */ 0x00000654,
+/* 00001300 */ 0x000002D8,
+/* 00001304 */ 0x000003D8,
+/* 00001308 */ 0x000011E4,
+/* 0000130C */ 0x000003C0,
+/* 00001310 */ 0x0000132C,
+/* 00001314 */ 0x000003FC,
+/* 00001318 */ 0x00000424,
+/* 0000131C */ 0x00000440,
+/* 00001320 */ 0x00000668,
+/* 00001324 */ 0x00000440,
+/* 00001328 */ 0x00000380,
+/* 0000132C */ 0x000003B0,
+/* 00001330 */ 0x00001344,
+/* 00001334 */ 0x00000668,
+/* 00001338 */ 0x00000668,
+/* 0000133C */ 0x000003C0,
+/* 00001340 */ 0x000012AC,
+/* 00001344 */ 0x000003FC,
+/* 00001348 */ 0x00000424,
+/* 0000134C */ 0x00000440,
+/* 00001350 */ 0x00000424,
+/* 00001354 */ 0x00000668,
+/* 00001358 */ 0x00000430,
+/* 0000135C */ 0x000011B8,
+/* 00001360 */ 0x00000440,
+/* 00001364 */ 0x00000380,
+/* 00001368 */ 0x00001278,
+/* 0000136C */ 0x4D414E05,
+/* 00001370 */ 0x00003F45,
+/* 00001374 */ 0x00000006,
+/* 00001378 */ 0x0000027C,
+/* 0000137C */ 0x00001280,
+/* 00001380 */ 0x00000380,
+/* 00001384 */ 0x0000136C,
+/* 00001388 */ 0x50584506,
+/* 0000138C */ 0x00544345,
+/* 00001390 */ 0x00000006,
+/* 00001394 */ 0x00000330,
+/* 00001398 */ 0x0000021C,
+/* 0000139C */ 0x000003CC,
+/* 000013A0 */ 0x00000424,
+/* 000013A4 */ 0x00000380,
+/* 000013A8 */ 0x00001388,
+/* 000013AC */ 0x45555105,
+/* 000013B0 */ 0x00005952,
+/* 000013B4 */ 0x00000006,
+/* 000013B8 */ 0x00000874,
+/* 000013BC */ 0x00000360,
+/* 000013C0 */ 0x00000100,
+/* 000013C4 */ 0x00000330,
+/* 000013C8 */ 0x00000240,
+/* 000013CC */ 0x000003CC,
+/* 000013D0 */ 0x00000424,
+/* 000013D4 */ 0x00000360,
+/* 000013D8 */ 0x00000000,
+/* 000013DC */ 0x0000022C,
+/* 000013E0 */ 0x000003CC,
+/* 000013E4 */ 0x00000380,
+/* 000013E8 */ 0x000013AC,
+/* 000013EC */ 0x4F424105,
+/* 000013F0 */ 0x00005452,
+/* 000013F4 */ 0x00000006,
+/* 000013F8 */ 0x00000320,
+/* 000013FC */ 0x000002C8,
+/* 00001400 */ 0x00000894,
+/* 00001404 */ 0x00000380,
+/* 00001408 */ 0x000013EC,
+/* 0000140C */ 0x6F626106,
+/* 00001410 */ 0x00227472,
+/* 00001414 */ 0x00000006,
+/* 00001418 */ 0x000003B0,
+/* 0000141C */ 0x00001430,
+/* 00001420 */ 0x00000E44,
+/* 00001424 */ 0x00000608,
+/* 00001428 */ 0x00000DE0,
+/* 0000142C */ 0x000013F4,
+/* 00001430 */ 0x00000E44,
+/* 00001434 */ 0x00000424,
+/* 00001438 */ 0x00000380,
+/* 0000143C */ 0x0000140C,
+/* 00001440 */ 0x52524505,
+/* 00001444 */ 0x0000524F,
+/* 00001448 */ 0x00000006,
+/* 0000144C */ 0x00000D64,
+/* 00001450 */ 0x00000608,
+/* 00001454 */ 0x00000DE0,
+/* 00001458 */ 0x00000360,
+/* 0000145C */ 0x0000003F,
+/* 00001460 */ 0x00000350,
+/* 00001464 */ 0x00000E1C,
+/* 00001468 */ 0x000013F4,
+/* 0000146C */ 0x00001440,
+/* 00001470 */ 0x4E49240A,
+/* 00001474 */ 0x50524554,
+/* 00001478 */ 0x00544552,
+/* 0000147C */ 0x00000006,
+/* 00001480 */ 0x00001374,
+/* 00001484 */ 0x0000049C,
+/* 00001488 */ 0x000003B0,
+/* 0000148C */ 0x000014BC,
+/* 00001490 */ 0x000003F0,
+/* 00001494 */ 0x00000360,
+/* 00001498 */ 0x00000040,
+/* 0000149C */ 0x00000468,
+/* 000014A0 */ 0x00001414,
+/* 000014A4 */ 0x6F63200D,
+/* 000014A8 */ 0x6C69706D,
+/* 000014AC */ 0x6E6F2065,
+/* 000014B0 */ 0x0000796C,
+/* 000014B4 */ 0x00000390,
+/* 000014B8 */ 0x00000380,
+/* 000014BC */ 0x00000C2C,
+/* 000014C0 */ 0x000003B0,
+/* 000014C4 */ 0x000014CC,
+/* 000014C8 */ 0x00000380,
+/* 000014CC */ 0x00001448,
+/* 000014D0 */ 0x00001470,
+/* 000014D4 */ 0x00005B81,
+/* 000014D8 */ 0x00000006,
+/* 000014DC */ 0x00000360,
+/* 000014E0 */ 0x0000147C,
+/* 000014E4 */ 0x000002B4,
+/* 000014E8 */ 0x000003CC,
+/* 000014EC */ 0x00000380,
+/* 000014F0 */ 0x000014D4,
+/* 000014F4 */ 0x4B4F2E03,
+/* 000014F8 */ 0x00000006,
+/* 000014FC */ 0x00000E1C,
+/* 00001500 */ 0x00000360,
+/* 00001504 */ 0x0000147C,
+/* 00001508 */ 0x000002B4,
+/* 0000150C */ 0x000003D8,
+/* 00001510 */ 0x00000524,
+/* 00001514 */ 0x000003B0,
+/* 00001518 */ 0x00001560,
+/* 0000151C */ 0x00000414,
+/* 00001520 */ 0x00000414,
+/* 00001524 */ 0x00000414,
+/* 00001528 */ 0x00000430,
+/* 0000152C */ 0x00000F2C,
+/* 00001530 */ 0x000003FC,
+/* 00001534 */ 0x00000430,
+/* 00001538 */ 0x00000F2C,
+/* 0000153C */ 0x000003FC,
+/* 00001540 */ 0x00000430,
+/* 00001544 */ 0x00000F2C,
+/* 00001548 */ 0x000003FC,
+/* 0000154C */ 0x00000430,
+/* 00001550 */ 0x00000F2C,
+/* 00001554 */ 0x00000E8C,
+/* 00001558 */ 0x6B6F2004,
+/* 0000155C */ 0x0000003E,
+/* 00001560 */ 0x00000380,
+/* 00001564 */ 0x000014F4,
+/* 00001568 */ 0x41564504,
+/* 0000156C */ 0x0000004C,
+/* 00001570 */ 0x00000006,
+/* 00001574 */ 0x000014D8,
+/* 00001578 */ 0x00001160,
+/* 0000157C */ 0x00000430,
+/* 00001580 */ 0x000003D8,
+/* 00001584 */ 0x000003B0,
+/* 00001588 */ 0x0000159C,
+/* 0000158C */ 0x000002B4,
+/* 00001590 */ 0x00000894,
+/* 00001594 */ 0x000003C0,
+/* 00001598 */ 0x00001578,
+/* 0000159C */ 0x00000424,
+/* 000015A0 */ 0x000014F8,
+/* 000015A4 */ 0x00000320,
+/* 000015A8 */ 0x00000380,
+/* 000015AC */ 0x00001568,
+/* 000015B0 */ 0x49555104,
+/* 000015B4 */ 0x00000054,
+/* 000015B8 */ 0x00000006,
+/* 000015BC */ 0x000014D8,
+/* 000015C0 */ 0x000013B4,
+/* 000015C4 */ 0x00001570,
+/* 000015C8 */ 0x000003C0,
+/* 000015CC */ 0x000015C0,
+/* 000015D0 */ 0x000015B0,
+/* 000015D4 */ 0x414F4C04,
+/* 000015D8 */ 0x00000044,
+/* 000015DC */ 0x00000006,
+/* 000015E0 */ 0x00000240,
+/* 000015E4 */ 0x000003CC,
+/* 000015E8 */ 0x00000254,
+/* 000015EC */ 0x000003CC,
+/* 000015F0 */ 0x00000360,
+/* 000015F4 */ 0x00000000,
+/* 000015F8 */ 0x0000022C,
+/* 000015FC */ 0x000003CC,
+/* 00001600 */ 0x00001570,
+/* 00001604 */ 0x00000380,
+/* 00001608 */ 0x000015D4,
+/* 0000160C */ 0x00002C01,
+/* 00001610 */ 0x00000006,
+/* 00001614 */ 0x0000083C,
+/* 00001618 */ 0x00000430,
+/* 0000161C */ 0x00000654,
+/* 00001620 */ 0x0000028C,
+/* 00001624 */ 0x000003CC,
+/* 00001628 */ 0x000003CC,
+/* 0000162C */ 0x00000380,
+/* 00001630 */ 0x0000160C,
+/* 00001634 */ 0x54494C87,
+/* 00001638 */ 0x4C415245,
+/* 0000163C */ 0x00000006,
+/* 00001640 */ 0x00000360,
+/* 00001644 */ 0x00000360,
+/* 00001648 */ 0x00001610,
+/* 0000164C */ 0x00001610,
+/* 00001650 */ 0x00000380,
+/* 00001654 */ 0x00001634,
+/* 00001658 */ 0x4C4C4105,
+/* 0000165C */ 0x0000544F,
+/* 00001660 */ 0x00000006,
+/* 00001664 */ 0x00000810,
+/* 00001668 */ 0x0000028C,
+/* 0000166C */ 0x000005E0,
+/* 00001670 */ 0x00000380,
+/* 00001674 */ 0x00001658,
+/* 00001678 */ 0x222C2403,
+/* 0000167C */ 0x00000006,
+/* 00001680 */ 0x00000360,
+/* 00001684 */ 0x00000022,
+/* 00001688 */ 0x00001194,
+/* 0000168C */ 0x00000608,
+/* 00001690 */ 0x000004D4,
+/* 00001694 */ 0x00000810,
+/* 00001698 */ 0x0000028C,
+/* 0000169C */ 0x000003CC,
+/* 000016A0 */ 0x00000380,
+/* 000016A4 */ 0x00001678,
+/* 000016A8 */ 0x4E553F07,
+/* 000016AC */ 0x45555149,
+/* 000016B0 */ 0x00000006,
+/* 000016B4 */ 0x00000430,
+/* 000016B8 */ 0x00001374,
+/* 000016BC */ 0x0000049C,
+/* 000016C0 */ 0x000003B0,
+/* 000016C4 */ 0x000016EC,
+/* 000016C8 */ 0x00000608,
+/* 000016CC */ 0x00000360,
+/* 000016D0 */ 0x0000001F,
+/* 000016D4 */ 0x00000468,
+/* 000016D8 */ 0x00000D64,
+/* 000016DC */ 0x00000DE0,
+/* 000016E0 */ 0x00000E8C,
+/* 000016E4 */ 0x65722006,
+/* 000016E8 */ 0x00666544,
+/* 000016EC */ 0x00000424,
+/* 000016F0 */ 0x00000380,
+/* 000016F4 */ 0x000016A8,
+/* 000016F8 */ 0x6E2C2403,
+/* 000016FC */ 0x00000006,
+/* 00001700 */ 0x00000430,
+/* 00001704 */ 0x000003D8,
+/* 00001708 */ 0x000003B0,
+/* 0000170C */ 0x00001748,
+/* 00001710 */ 0x000016B0,
+/* 00001714 */ 0x00000430,
+/* 00001718 */ 0x000011B8,
+/* 0000171C */ 0x0000028C,
+/* 00001720 */ 0x000003CC,
+/* 00001724 */ 0x00000430,
+/* 00001728 */ 0x000002A0,
+/* 0000172C */ 0x000003CC,
+/* 00001730 */ 0x00000668,
+/* 00001734 */ 0x0000027C,
+/* 00001738 */ 0x000003D8,
+/* 0000173C */ 0x00000440,
+/* 00001740 */ 0x000003CC,
+/* 00001744 */ 0x00000380,
+/* 00001748 */ 0x00001448,
+/* 0000174C */ 0x000016F8,
+/* 00001750 */ 0x00002701,
+/* 00001754 */ 0x00000006,
+/* 00001758 */ 0x00001160,
+/* 0000175C */ 0x00001374,
+/* 00001760 */ 0x000003B0,
+/* 00001764 */ 0x0000176C,
+/* 00001768 */ 0x00000380,
+/* 0000176C */ 0x00001448,
+/* 00001770 */ 0x00001750,
+/* 00001774 */ 0x4F435B89,
+/* 00001778 */ 0x4C49504D,
+/* 0000177C */ 0x00005D45,
+/* 00001780 */ 0x00000006,
+/* 00001784 */ 0x00001754,
+/* 00001788 */ 0x00001610,
+/* 0000178C */ 0x00000380,
+/* 00001790 */ 0x00001774,
+/* 00001794 */ 0x4D4F4307,
+/* 00001798 */ 0x454C4950,
+/* 0000179C */ 0x00000006,
+/* 000017A0 */ 0x000003FC,
+/* 000017A4 */ 0x00000430,
+/* 000017A8 */ 0x000003D8,
+/* 000017AC */ 0x00001610,
+/* 000017B0 */ 0x00000654,
+/* 000017B4 */ 0x00000414,
+/* 000017B8 */ 0x00000380,
+/* 000017BC */ 0x00001794,
+/* 000017C0 */ 0x4F432408,
+/* 000017C4 */ 0x4C49504D,
+/* 000017C8 */ 0x00000045,
+/* 000017CC */ 0x00000006,
+/* 000017D0 */ 0x00001374,
+/* 000017D4 */ 0x0000049C,
+/* 000017D8 */ 0x000003B0,
+/* 000017DC */ 0x0000180C,
+/* 000017E0 */ 0x000003D8,
+/* 000017E4 */ 0x00000360,
+/* 000017E8 */ 0x00000080,
+/* 000017EC */ 0x00000468,
+/* 000017F0 */ 0x000003B0,
+/* 000017F4 */ 0x00001804,
+/* 000017F8 */ 0x00000390,
+/* 000017FC */ 0x000003C0,
+/* 00001800 */ 0x00001808,
+/* 00001804 */ 0x00001610,
+/* 00001808 */ 0x00000380,
+/* 0000180C */ 0x00000C2C,
+/* 00001810 */ 0x000003B0,
+/* 00001814 */ 0x00001820,
+/* 00001818 */ 0x0000163C,
+/* 0000181C */ 0x00000380,
+/* 00001820 */ 0x00001448,
+/* 00001824 */ 0x000017C0,
+/* 00001828 */ 0x45564F05,
+/* 0000182C */ 0x00005452,
+/* 00001830 */ 0x00000006,
+/* 00001834 */ 0x000002A0,
+/* 00001838 */ 0x000003D8,
+/* 0000183C */ 0x0000027C,
+/* 00001840 */ 0x000003CC,
+/* 00001844 */ 0x00000380,
+/* 00001848 */ 0x00001828,
+/* 0000184C */ 0x00005D01,
+/* 00001850 */ 0x00000006,
+/* 00001854 */ 0x00000360,
+/* 00001858 */ 0x000017CC,
+/* 0000185C */ 0x000002B4,
+/* 00001860 */ 0x000003CC,
+/* 00001864 */ 0x00000380,
+/* 00001868 */ 0x0000184C,
+/* 0000186C */ 0x00003A01,
+/* 00001870 */ 0x00000006,
+/* 00001874 */ 0x00001160,
+/* 00001878 */ 0x000016FC,
+/* 0000187C */ 0x00001850,
+/* 00001880 */ 0x00000360,
+/* 00001884 */ 0x00000006,
+/* 00001888 */ 0x00001610,
+/* 0000188C */ 0x00000380,
+/* 00001890 */ 0x0000186C,
+/* 00001894 */ 0x00003B81,
+/* 00001898 */ 0x00000006,
+/* 0000189C */ 0x00000360,
+/* 000018A0 */ 0x00000380,
+/* 000018A4 */ 0x00001610,
+/* 000018A8 */ 0x000014D8,
+/* 000018AC */ 0x00001830,
+/* 000018B0 */ 0x00000380,
+/* 000018B4 */ 0x00001894,
+/* 000018B8 */ 0x2B6D6403,
+/* 000018BC */ 0x00000006,
+/* 000018C0 */ 0x00000450,
+/* 000018C4 */ 0x00000360,
+/* 000018C8 */ 0x00000006,
+/* 000018CC */ 0x00000ED4,
+/* 000018D0 */ 0x00000414,
+/* 000018D4 */ 0x000003C0,
+/* 000018D8 */ 0x000018F4,
+/* 000018DC */ 0x00000430,
+/* 000018E0 */ 0x000003D8,
+/* 000018E4 */ 0x00000360,
+/* 000018E8 */ 0x00000009,
+/* 000018EC */ 0x00000ED4,
+/* 000018F0 */ 0x00000654,
+/* 000018F4 */ 0x000003A0,
+/* 000018F8 */ 0x000018DC,
+/* 000018FC */ 0x00000380,
+/* 00001900 */ 0x000018B8,
+/* 00001904 */ 0x4D554404,
+/* 00001908 */ 0x00000050,
+/* 0000190C */ 0x00000006,
+/* 00001910 */ 0x00000268,
+/* 00001914 */ 0x000003D8,
+/* 00001918 */ 0x00000414,
+/* 0000191C */ 0x00000B18,
+/* 00001920 */ 0x00000360,
+/* 00001924 */ 0x0000001F,
+/* 00001928 */ 0x000004D4,
+/* 0000192C */ 0x00000360,
+/* 00001930 */ 0x00000020,
+/* 00001934 */ 0x00000584,
+/* 00001938 */ 0x00000414,
+/* 0000193C */ 0x000003C0,
+/* 00001940 */ 0x0000196C,
+/* 00001944 */ 0x00000E1C,
+/* 00001948 */ 0x00000360,
+/* 0000194C */ 0x00000008,
+/* 00001950 */ 0x000004C8,
+/* 00001954 */ 0x000018BC,
+/* 00001958 */ 0x00000414,
+/* 0000195C */ 0x00000D64,
+/* 00001960 */ 0x0000067C,
+/* 00001964 */ 0x00000DE0,
+/* 00001968 */ 0x000003FC,
+/* 0000196C */ 0x000003A0,
+/* 00001970 */ 0x00001944,
+/* 00001974 */ 0x00000424,
+/* 00001978 */ 0x000003FC,
+/* 0000197C */ 0x00000268,
+/* 00001980 */ 0x000003CC,
+/* 00001984 */ 0x00000380,
+/* 00001988 */ 0x00001904,
+/* 0000198C */ 0x414E3E05,
+/* 00001990 */ 0x0000454D,
+/* 00001994 */ 0x00000006,
+/* 00001998 */ 0x0000027C,
+/* 0000199C */ 0x000003D8,
+/* 000019A0 */ 0x00000430,
+/* 000019A4 */ 0x000003B0,
+/* 000019A8 */ 0x000019E0,
+/* 000019AC */ 0x000004C8,
+/* 000019B0 */ 0x000011B8,
+/* 000019B4 */ 0x00000480,
+/* 000019B8 */ 0x000003B0,
+/* 000019BC */ 0x000019CC,
+/* 000019C0 */ 0x000006B0,
+/* 000019C4 */ 0x000003C0,
+/* 000019C8 */ 0x000019D8,
+/* 000019CC */ 0x00000440,
+/* 000019D0 */ 0x00000424,
+/* 000019D4 */ 0x00000380,
+/* 000019D8 */ 0x000003C0,
+/* 000019DC */ 0x0000199C,
+/* 000019E0 */ 0x00000440,
+/* 000019E4 */ 0x00000424,
+/* 000019E8 */ 0x00000380,
+/* 000019EC */ 0x0000198C,
+/* 000019F0 */ 0x44492E03,
+/* 000019F4 */ 0x00000006,
+/* 000019F8 */ 0x00000608,
+/* 000019FC */ 0x00000360,
+/* 00001A00 */ 0x0000001F,
+/* 00001A04 */ 0x00000468,
+/* 00001A08 */ 0x00000DE0,
+/* 00001A0C */ 0x00000D64,
+/* 00001A10 */ 0x00000380,
+/* 00001A14 */ 0x000019F0,
+/* 00001A18 */ 0x524F5705,
+/* 00001A1C */ 0x00005344,
+/* 00001A20 */ 0x00000006,
+/* 00001A24 */ 0x00000E1C,
+/* 00001A28 */ 0x0000027C,
+/* 00001A2C */ 0x00000360,
+/* 00001A30 */ 0x00000000,
+/* 00001A34 */ 0x000002D8,
+/* 00001A38 */ 0x000003CC,
+/* 00001A3C */ 0x000003D8,
+/* 00001A40 */ 0x0000049C,
+/* 00001A44 */ 0x000003B0,
+/* 00001A48 */ 0x00001AAC,
+/* 00001A4C */ 0x00000430,
+/* 00001A50 */ 0x00000D64,
+/* 00001A54 */ 0x000019F4,
+/* 00001A58 */ 0x00000668,
+/* 00001A5C */ 0x000002D8,
+/* 00001A60 */ 0x000003D8,
+/* 00001A64 */ 0x00000360,
+/* 00001A68 */ 0x00000010,
+/* 00001A6C */ 0x0000053C,
+/* 00001A70 */ 0x000003B0,
+/* 00001A74 */ 0x00001A90,
+/* 00001A78 */ 0x00000360,
+/* 00001A7C */ 0x00000001,
+/* 00001A80 */ 0x000002D8,
+/* 00001A84 */ 0x000005E0,
+/* 00001A88 */ 0x000003C0,
+/* 00001A8C */ 0x00001AA4,
+/* 00001A90 */ 0x00000E1C,
+/* 00001A94 */ 0x00000360,
+/* 00001A98 */ 0x00000000,
+/* 00001A9C */ 0x000002D8,
+/* 00001AA0 */ 0x000003CC,
+/* 00001AA4 */ 0x000003C0,
+/* 00001AA8 */ 0x00001A3C,
+/* 00001AAC */ 0x00000380,
+/* 00001AB0 */ 0x00001A18,
+/* 00001AB4 */ 0x524F4606,
+/* 00001AB8 */ 0x00544547,
+/* 00001ABC */ 0x00000006,
+/* 00001AC0 */ 0x00001160,
+/* 00001AC4 */ 0x00001374,
+/* 00001AC8 */ 0x0000049C,
+/* 00001ACC */ 0x000003B0,
+/* 00001AD0 */ 0x00001B04,
+/* 00001AD4 */ 0x00000668,
+/* 00001AD8 */ 0x00000430,
+/* 00001ADC */ 0x0000028C,
+/* 00001AE0 */ 0x000003CC,
+/* 00001AE4 */ 0x000003D8,
+/* 00001AE8 */ 0x00000430,
+/* 00001AEC */ 0x0000027C,
+/* 00001AF0 */ 0x000003CC,
+/* 00001AF4 */ 0x000002A0,
+/* 00001AF8 */ 0x000003CC,
+/* 00001AFC */ 0x00000424,
+/* 00001B00 */ 0x00000380,
+/* 00001B04 */ 0x00001448,
+/* 00001B08 */ 0x00001AB4,
+/* 00001B0C */ 0x4C4F4304,
+/* 00001B10 */ 0x00000044,
+/* 00001B14 */ 0x00000006,
+/* 00001B18 */ 0x00000E1C,
+/* 00001B1C */ 0x00000E8C,
+/* 00001B20 */ 0x70736516,
+/* 00001B24 */ 0x6F663233,
+/* 00001B28 */ 0x20687472,
+/* 00001B2C */ 0x332E3656,
+/* 00001B30 */ 0x3032202C,
+/* 00001B34 */ 0x00203931,
+/* 00001B38 */ 0x00000E1C,
+/* 00001B3C */ 0x00000380,
+/* 00001B40 */ 0x00001B0C,
+/* 00001B44 */ 0x4E494C04,
+/* 00001B48 */ 0x00000045,
+/* 00001B4C */ 0x00000006,
+/* 00001B50 */ 0x00000360,
+/* 00001B54 */ 0x00000007,
+/* 00001B58 */ 0x00000414,
+/* 00001B5C */ 0x00000430,
+/* 00001B60 */ 0x00000728,
+/* 00001B64 */ 0x00000360,
+/* 00001B68 */ 0x00000009,
+/* 00001B6C */ 0x00000ED4,
+/* 00001B70 */ 0x00000654,
+/* 00001B74 */ 0x000003A0,
+/* 00001B78 */ 0x00001B5C,
+/* 00001B7C */ 0x00000380,
+/* 00001B80 */ 0x00001B44,
+/* 00001B84 */ 0x00505002,
+/* 00001B88 */ 0x00000006,
+/* 00001B8C */ 0x00000414,
+/* 00001B90 */ 0x000003C0,
+/* 00001B94 */ 0x00001BB4,
+/* 00001B98 */ 0x00000E1C,
+/* 00001B9C */ 0x00000430,
+/* 00001BA0 */ 0x00000360,
+/* 00001BA4 */ 0x00000009,
+/* 00001BA8 */ 0x00000ED4,
+/* 00001BAC */ 0x00000D64,
+/* 00001BB0 */ 0x00001B4C,
+/* 00001BB4 */ 0x000003A0,
+/* 00001BB8 */ 0x00001B98,
+/* 00001BBC */ 0x00000380,
+/* 00001BC0 */ 0x00001B84,
+/* 00001BC4 */ 0x00305002,
+/* 00001BC8 */ 0x00000006,
+/* 00001BCC */ 0x00000360,
+/* 00001BD0 */ 0x3FF44004,
+/* 00001BD4 */ 0x00000718,
+/* 00001BD8 */ 0x00000380,
+/* 00001BDC */ 0x00001BC4,
+/* 00001BE0 */ 0x53305003,
+/* 00001BE4 */ 0x00000006,
+/* 00001BE8 */ 0x00000360,
+/* 00001BEC */ 0x3FF44008,
+/* 00001BF0 */ 0x00000718,
+/* 00001BF4 */ 0x00000380,
+/* 00001BF8 */ 0x00001BE0,
+/* 00001BFC */ 0x43305003,
+/* 00001C00 */ 0x00000006,
+/* 00001C04 */ 0x00000360,
+/* 00001C08 */ 0x3FF4400C,
+/* 00001C0C */ 0x00000718,
+/* 00001C10 */ 0x00000380,
+/* 00001C14 */ 0x00001BFC,
+/* 00001C18 */ 0x00315002,
+/* 00001C1C */ 0x00000006,
+/* 00001C20 */ 0x00000360,
+/* 00001C24 */ 0x3FF44010,
+/* 00001C28 */ 0x00000718,
+/* 00001C2C */ 0x00000380,
+/* 00001C30 */ 0x00001C18,
+/* 00001C34 */ 0x53315003,
+/* 00001C38 */ 0x00000006,
+/* 00001C3C */ 0x00000360,
+/* 00001C40 */ 0x3FF44014,
+/* 00001C44 */ 0x00000718,
+/* 00001C48 */ 0x00000380,
+/* 00001C4C */ 0x00001C34,
+/* 00001C50 */ 0x43315003,
+/* 00001C54 */ 0x00000006,
+/* 00001C58 */ 0x00000360,
+/* 00001C5C */ 0x3FF44018,
+/* 00001C60 */ 0x00000718,
+/* 00001C64 */ 0x00000380,
+/* 00001C68 */ 0x00001C50,
+/* 00001C6C */ 0x45305004,
+/* 00001C70 */ 0x0000004E,
+/* 00001C74 */ 0x00000006,
+/* 00001C78 */ 0x00000360,
+/* 00001C7C */ 0x3FF44020,
+/* 00001C80 */ 0x00000718,
+/* 00001C84 */ 0x00000380,
+/* 00001C88 */ 0x00001C6C,
+/* 00001C8C */ 0x45305005,
+/* 00001C90 */ 0x0000534E,
+/* 00001C94 */ 0x00000006,
+/* 00001C98 */ 0x00000360,
+/* 00001C9C */ 0x3FF44024,
+/* 00001CA0 */ 0x00000718,
+/* 00001CA4 */ 0x00000380,
+/* 00001CA8 */ 0x00001C8C,
+/* 00001CAC */ 0x45305005,
+/* 00001CB0 */ 0x0000434E,
+/* 00001CB4 */ 0x00000006,
+/* 00001CB8 */ 0x00000360,
+/* 00001CBC */ 0x3FF44028,
+/* 00001CC0 */ 0x00000718,
+/* 00001CC4 */ 0x00000380,
+/* 00001CC8 */ 0x00001CAC,
+/* 00001CCC */ 0x45315004,
+/* 00001CD0 */ 0x0000004E,
+/* 00001CD4 */ 0x00000006,
+/* 00001CD8 */ 0x00000360,
+/* 00001CDC */ 0x3FF4402C,
+/* 00001CE0 */ 0x00000718,
+/* 00001CE4 */ 0x00000380,
+/* 00001CE8 */ 0x00001CCC,
+/* 00001CEC */ 0x45315005,
+/* 00001CF0 */ 0x0000534E,
+/* 00001CF4 */ 0x00000006,
+/* 00001CF8 */ 0x00000360,
+/* 00001CFC */ 0x3FF44030,
+/* 00001D00 */ 0x00000718,
+/* 00001D04 */ 0x00000380,
+/* 00001D08 */ 0x00001CEC,
+/* 00001D0C */ 0x45315005,
+/* 00001D10 */ 0x0000434E,
+/* 00001D14 */ 0x00000006,
+/* 00001D18 */ 0x00000360,
+/* 00001D1C */ 0x3FF44034,
+/* 00001D20 */ 0x00000718,
+/* 00001D24 */ 0x00000380,
+/* 00001D28 */ 0x00001D0C,
+/* 00001D2C */ 0x49305004,
+/* 00001D30 */ 0x0000004E,
+/* 00001D34 */ 0x00000006,
+/* 00001D38 */ 0x00000360,
+/* 00001D3C */ 0x3FF4403C,
+/* 00001D40 */ 0x00000728,
+/* 00001D44 */ 0x00000F2C,
+/* 00001D48 */ 0x00000380,
+/* 00001D4C */ 0x00001D2C,
+/* 00001D50 */ 0x49315004,
+/* 00001D54 */ 0x0000004E,
+/* 00001D58 */ 0x00000006,
+/* 00001D5C */ 0x00000360,
+/* 00001D60 */ 0x3FF44040,
+/* 00001D64 */ 0x00000728,
+/* 00001D68 */ 0x00000F2C,
+/* 00001D6C */ 0x00000380,
+/* 00001D70 */ 0x00001D50,
+/* 00001D74 */ 0x50505003,
+/* 00001D78 */ 0x00000006,
+/* 00001D7C */ 0x00000360,
+/* 00001D80 */ 0x3FF44000,
+/* 00001D84 */ 0x00000360,
+/* 00001D88 */ 0x00000003,
+/* 00001D8C */ 0x00001B88,
+/* 00001D90 */ 0x00000424,
+/* 00001D94 */ 0x00000380,
+/* 00001D98 */ 0x00001D74,
+/* 00001D9C */ 0x494D4505,
+/* 00001DA0 */ 0x00005454,
+/* 00001DA4 */ 0x00000006,
+/* 00001DA8 */ 0x00000360,
+/* 00001DAC */ 0x00000003,
+/* 00001DB0 */ 0x00000414,
+/* 00001DB4 */ 0x00000360,
+/* 00001DB8 */ 0x00000000,
+/* 00001DBC */ 0x00000360,
+/* 00001DC0 */ 0x00000100,
+/* 00001DC4 */ 0x0000055C,
+/* 00001DC8 */ 0x00000440,
+/* 00001DCC */ 0x000007C8,
+/* 00001DD0 */ 0x00000350,
+/* 00001DD4 */ 0x000003A0,
+/* 00001DD8 */ 0x00001DB4,
+/* 00001DDC */ 0x00000424,
+/* 00001DE0 */ 0x00000380,
+/* 00001DE4 */ 0x00001D9C,
+/* 00001DE8 */ 0x50595405,
+/* 00001DEC */ 0x00004545,
+/* 00001DF0 */ 0x00000006,
+/* 00001DF4 */ 0x00000D64,
+/* 00001DF8 */ 0x00000360,
+/* 00001DFC */ 0x00000007,
+/* 00001E00 */ 0x00000414,
+/* 00001E04 */ 0x00000430,
+/* 00001E08 */ 0x00000728,
+/* 00001E0C */ 0x00001DA4,
+/* 00001E10 */ 0x00000654,
+/* 00001E14 */ 0x000003A0,
+/* 00001E18 */ 0x00001E04,
+/* 00001E1C */ 0x00000424,
+/* 00001E20 */ 0x00000380,
+/* 00001E24 */ 0x00001DE8,
+/* 00001E28 */ 0x50505004,
+/* 00001E2C */ 0x00000050,
+/* 00001E30 */ 0x00000006,
+/* 00001E34 */ 0x00000414,
+/* 00001E38 */ 0x000003C0,
+/* 00001E3C */ 0x00001E68,
+/* 00001E40 */ 0x00000E1C,
+/* 00001E44 */ 0x00000430,
+/* 00001E48 */ 0x00000430,
+/* 00001E4C */ 0x00000360,
+/* 00001E50 */ 0x00000009,
+/* 00001E54 */ 0x00000ED4,
+/* 00001E58 */ 0x00000D64,
+/* 00001E5C */ 0x00001B4C,
+/* 00001E60 */ 0x00000440,
+/* 00001E64 */ 0x00001DF0,
+/* 00001E68 */ 0x000003A0,
+/* 00001E6C */ 0x00001E40,
+/* 00001E70 */ 0x00000380,
+/* 00001E74 */ 0x00001E28,
+/* 00001E78 */ 0x4B4B4B03,
+/* 00001E7C */ 0x00000006,
+/* 00001E80 */ 0x00000360,
+/* 00001E84 */ 0x3FF59000,
+/* 00001E88 */ 0x00000360,
+/* 00001E8C */ 0x00000010,
+/* 00001E90 */ 0x00001B88,
+/* 00001E94 */ 0x00000424,
+/* 00001E98 */ 0x00000380,
+/* 00001E9C */ 0x00001E78,
+/* 00001EA0 */ 0x45485484,
+/* 00001EA4 */ 0x0000004E,
+/* 00001EA8 */ 0x00000006,
+/* 00001EAC */ 0x0000083C,
+/* 00001EB0 */ 0x00000440,
+/* 00001EB4 */ 0x000003CC,
+/* 00001EB8 */ 0x00000380,
+/* 00001EBC */ 0x00001EA0,
+/* 00001EC0 */ 0x524F4683,
+/* 00001EC4 */ 0x00000006,
+/* 00001EC8 */ 0x0000179C,
+/* 00001ECC */ 0x00000414,
+/* 00001ED0 */ 0x0000083C,
+/* 00001ED4 */ 0x00000380,
+/* 00001ED8 */ 0x00001EC0,
+/* 00001EDC */ 0x47454285,
+/* 00001EE0 */ 0x00004E49,
+/* 00001EE4 */ 0x00000006,
+/* 00001EE8 */ 0x0000083C,
+/* 00001EEC */ 0x00000380,
+/* 00001EF0 */ 0x00001EDC,
+/* 00001EF4 */ 0x58454E84,
+/* 00001EF8 */ 0x00000054,
+/* 00001EFC */ 0x00000006,
+/* 00001F00 */ 0x0000179C,
+/* 00001F04 */ 0x000003A0,
+/* 00001F08 */ 0x00001610,
+/* 00001F0C */ 0x00000380,
+/* 00001F10 */ 0x00001EF4,
+/* 00001F14 */ 0x544E5585,
+/* 00001F18 */ 0x00004C49,
+/* 00001F1C */ 0x00000006,
+/* 00001F20 */ 0x0000179C,
+/* 00001F24 */ 0x000003B0,
+/* 00001F28 */ 0x00001610,
+/* 00001F2C */ 0x00000380,
+/* 00001F30 */ 0x00001F14,
+/* 00001F34 */ 0x41474185,
+/* 00001F38 */ 0x00004E49,
+/* 00001F3C */ 0x00000006,
+/* 00001F40 */ 0x0000179C,
+/* 00001F44 */ 0x000003C0,
+/* 00001F48 */ 0x00001610,
+/* 00001F4C */ 0x00000380,
+/* 00001F50 */ 0x00001F34,
+/* 00001F54 */ 0x00464982,
+/* 00001F58 */ 0x00000006,
+/* 00001F5C */ 0x0000179C,
+/* 00001F60 */ 0x000003B0,
+/* 00001F64 */ 0x0000083C,
+/* 00001F68 */ 0x00000360,
+/* 00001F6C */ 0x00000000,
+/* 00001F70 */ 0x00001610,
+/* 00001F74 */ 0x00000380,
+/* 00001F78 */ 0x00001F54,
+/* 00001F7C */ 0x45484185,
+/* 00001F80 */ 0x00004441,
+/* 00001F84 */ 0x00000006,
+/* 00001F88 */ 0x0000179C,
+/* 00001F8C */ 0x000003C0,
+/* 00001F90 */ 0x0000083C,
+/* 00001F94 */ 0x00000360,
+/* 00001F98 */ 0x00000000,
+/* 00001F9C */ 0x00001610,
+/* 00001FA0 */ 0x00000380,
+/* 00001FA4 */ 0x00001F7C,
+/* 00001FA8 */ 0x50455286,
+/* 00001FAC */ 0x00544145,
+/* 00001FB0 */ 0x00000006,
+/* 00001FB4 */ 0x00001F3C,
+/* 00001FB8 */ 0x00001EA8,
+/* 00001FBC */ 0x00000380,
+/* 00001FC0 */ 0x00001FA8,
+/* 00001FC4 */ 0x54464183,
+/* 00001FC8 */ 0x00000006,
+/* 00001FCC */ 0x00000424,
+/* 00001FD0 */ 0x00001F84,
+/* 00001FD4 */ 0x0000083C,
+/* 00001FD8 */ 0x00000440,
+/* 00001FDC */ 0x00000380,
+/* 00001FE0 */ 0x00001FC4,
+/* 00001FE4 */ 0x534C4584,
+/* 00001FE8 */ 0x00000045,
+/* 00001FEC */ 0x00000006,
+/* 00001FF0 */ 0x00001F84,
+/* 00001FF4 */ 0x00000440,
+/* 00001FF8 */ 0x00001EA8,
+/* 00001FFC */ 0x00000380,
+/* 00002000 */ 0x00001FE4,
+/* 00002004 */ 0x49485785,
+/* 00002008 */ 0x0000454C,
+/* 0000200C */ 0x00000006,
+/* 00002010 */ 0x00001F58,
+/* 00002014 */ 0x00000440,
+/* 00002018 */ 0x00000380,
+/* 0000201C */ 0x00002004,
+/* 00002020 */ 0x4F424186,
+/* 00002024 */ 0x00225452,
+/* 00002028 */ 0x00000006,
+/* 0000202C */ 0x00000360,
+/* 00002030 */ 0x00001414,
+/* 00002034 */ 0x0000083C,
+/* 00002038 */ 0x000003CC,
+/* 0000203C */ 0x0000167C,
+/* 00002040 */ 0x00000380,
+/* 00002044 */ 0x00002020,
+/* 00002048 */ 0x00222482,
+/* 0000204C */ 0x00000006,
+/* 00002050 */ 0x00000360,
+/* 00002054 */ 0x00000E78,
+/* 00002058 */ 0x0000083C,
+/* 0000205C */ 0x000003CC,
+/* 00002060 */ 0x0000167C,
+/* 00002064 */ 0x00000380,
+/* 00002068 */ 0x00002048,
+/* 0000206C */ 0x00222E82,
+/* 00002070 */ 0x00000006,
+/* 00002074 */ 0x00000360,
+/* 00002078 */ 0x00000E8C,
+/* 0000207C */ 0x0000083C,
+/* 00002080 */ 0x000003CC,
+/* 00002084 */ 0x0000167C,
+/* 00002088 */ 0x00000380,
+/* 0000208C */ 0x0000206C,
+/* 00002090 */ 0x444F4304,
+/* 00002094 */ 0x00000045,
+/* 00002098 */ 0x00000006,
+/* 0000209C */ 0x00001160,
+/* 000020A0 */ 0x000016FC,
+/* 000020A4 */ 0x00001830,
+/* 000020A8 */ 0x00000810,
+/* 000020AC */ 0x00000380,
+/* 000020B0 */ 0x00002090,
+/* 000020B4 */ 0x45524306,
+/* 000020B8 */ 0x00455441,
+/* 000020BC */ 0x00000006,
+/* 000020C0 */ 0x00002098,
+/* 000020C4 */ 0x00000360,
+/* 000020C8 */ 0x0000203D,
+/* 000020CC */ 0x00001610,
+/* 000020D0 */ 0x00000380,
+/* 000020D4 */ 0x000020B4,
+/* 000020D8 */ 0x52415608,
+/* 000020DC */ 0x4C424149,
+/* 000020E0 */ 0x00000045,
+/* 000020E4 */ 0x00000006,
+/* 000020E8 */ 0x000020BC,
+/* 000020EC */ 0x00000360,
+/* 000020F0 */ 0x00000000,
+/* 000020F4 */ 0x00001610,
+/* 000020F8 */ 0x00000380,
+/* 000020FC */ 0x000020D8,
+/* 00002100 */ 0x4E4F4308,
+/* 00002104 */ 0x4E415453,
+/* 00002108 */ 0x00000054,
+/* 0000210C */ 0x00000006,
+/* 00002110 */ 0x00002098,
+/* 00002114 */ 0x00000360,
+/* 00002118 */ 0x00002004,
+/* 0000211C */ 0x00001610,
+/* 00002120 */ 0x00001610,
+/* 00002124 */ 0x00000380,
+/* 00002128 */ 0x00002100,
+/* 0000212C */ 0x00282E82,
+/* 00002130 */ 0x00000006,
+/* 00002134 */ 0x00000360,
+/* 00002138 */ 0x00000029,
+/* 0000213C */ 0x00001114,
+/* 00002140 */ 0x00000DE0,
+/* 00002144 */ 0x00000380,
+/* 00002148 */ 0x0000212C,
+/* 0000214C */ 0x00005C81,
+/* 00002150 */ 0x00000006,
+/* 00002154 */ 0x00000360,
+/* 00002158 */ 0x0000000A,
+/* 0000215C */ 0x00001194,
+/* 00002160 */ 0x00000424,
+/* 00002164 */ 0x00000380,
+/* 00002168 */ 0x0000214C,
+/* 0000216C */ 0x00002881,
+/* 00002170 */ 0x00000006,
+/* 00002174 */ 0x00000360,
+/* 00002178 */ 0x00000029,
+/* 0000217C */ 0x00001114,
+/* 00002180 */ 0x000004B8,
+/* 00002184 */ 0x00000380,
+/* 00002188 */ 0x0000216C,
+/* 0000218C */ 0x4D4F430C,
+/* 00002190 */ 0x454C4950,
+/* 00002194 */ 0x4C4E4F2D,
+/* 00002198 */ 0x00000059,
+/* 0000219C */ 0x00000006,
+/* 000021A0 */ 0x00000360,
+/* 000021A4 */ 0x00000040,
+/* 000021A8 */ 0x000002A0,
+/* 000021AC */ 0x000003D8,
+/* 000021B0 */ 0x000005E0,
+/* 000021B4 */ 0x00000380,
+/* 000021B8 */ 0x0000218C,
+/* 000021BC */ 0x4D4D4909,
+/* 000021C0 */ 0x41494445,
+/* 000021C4 */ 0x00004554,
+/* 000021C8 */ 0x00000006,
+/* 000021CC */ 0x00000360,
+/* 000021D0 */ 0x00000080,
+/* 000021D4 */ 0x000002A0,
+/* 000021D8 */ 0x000003D8,
+/* 000021DC */ 0x000005E0,
+/* 000021E0 */ 0x00000380,
+0 } ;
@@ -0,0 +1,107 @@
+/******************************************************************************/
+/* Arduino.h - host stand-in for the Arduino/ESP-IDF calls esp32forth8_1 uses */
+/******************************************************************************/
+/* Just enough to build the sketch with g++ on Linux for the host programs in  */
+/* this directory. Threads are pthreads, SPIFFS is the ./data directory and    */
+/* the timer/GPIO interrupts are plain function pointers a test can call.      */
+/******************************************************************************/
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <algorithm>
+using std::min; using std::max;
+#define PROGMEM
+#define F(s) s
+#define HEX 16
+#define OUTPUT 1
+#define INPUT 0
+#define HIGH 1
+#define LOW 0
+#define MALLOC_CAP_8BIT 0
+static inline unsigned long millis() { timespec t; clock_gettime(CLOCK_MONOTONIC,&t); return t.tv_sec*1000+t.tv_nsec/1000000; }
+static inline unsigned long micros() { timespec t; clock_gettime(CLOCK_MONOTONIC,&t); return t.tv_sec*1000000+t.tv_nsec/1000; }
+static inline void delay(unsigned long ms) { usleep(ms*1000); }
+static inline void delayMicroseconds(unsigned long us) { usleep(us); }
+static inline void yield() { sched_yield(); }
+static inline void *ps_calloc(size_t n, size_t s) { return calloc(n, s); }
+static inline void pinMode(int,int) {}
+static inline void digitalWrite(int,int) {}
+static inline int  digitalRead(int) { return 0; }
+static inline int  analogRead(int) { return 0; }
+static inline void ledcWrite(int,int) {}
+static inline void ledcAttachPin(int,int) {}
+static inline void ledcSetup(int,int,int) {}
+static inline void ledcWriteTone(int,int) {}
+static inline int  xPortGetCoreID() { return 0; }
+static inline size_t heap_caps_get_largest_free_block(int){return 0;}
+static inline size_t heap_caps_get_free_size(int){return 0;}
+static inline size_t heap_caps_get_minimum_free_size(int){return 0;}
+static inline bool heap_caps_check_integrity_all(bool){return true;}
+static inline int uxTaskGetStackHighWaterMark(void*){return 0;}
+struct String : std::string {
+    String(const char *s="") : std::string(s) {}
+    String(const std::string &s) : std::string(s) {}
+    bool startsWith(const char *p) const { return rfind(p,0)==0; }
+    size_t length() const { return size(); }
+    void reserve(size_t n) { std::string::reserve(n); }
+    String &operator+=(char c) { push_back(c); return *this; }
+    String &operator+=(const std::string &x) { append(x); return *this; }
+};
+struct HardwareSerial {
+    void begin(int) {}
+    void print(const char *s) { fputs(s, stdout); }
+    void print(const std::string &s) { fputs(s.c_str(), stdout); }
+    void print(char c) { putchar(c); }
+    void print(long v, int b=10) { printf(b==16 ? "%lx" : "%ld", v); }
+    void print(int v, int b=10) { print((long)v, b); }
+    void print(unsigned long v, int b=10) { print((long)v, b); }
+    void print(unsigned int v, int b=10) { print((long)v, b); }
+    template<class T> void println(T v) { print(v); putchar('\n'); }
+    void println() { putchar('\n'); }
+    int available() { return 0; }
+    int read() { return -1; }
+    String readString() { return String(); }
+};
+extern HardwareSerial Serial;
+struct File {
+    FILE *f=0;
+    operator bool() const { return f; }
+    int available() { int c=fgetc(f); if (c==EOF) return 0; ungetc(c,f); return 1; }
+    int read() { return fgetc(f); }
+    size_t read(uint8_t *b, size_t n) { return fread(b,1,n,f); }
+    size_t write(const uint8_t *b, size_t n) { return fwrite(b,1,n,f); }
+    size_t size() { long p=ftell(f); fseek(f,0,SEEK_END); long n=ftell(f); fseek(f,p,SEEK_SET); return n; }
+    String readStringUntil(char t) { String s; int c; while ((c=fgetc(f))!=EOF && c!=t) s+=(char)c; return s; }
+    void close() { if (f) fclose(f); f=0; }
+};
+struct FS {
+    bool begin(bool=false) { return true; }
+    void end() {}
+    File open(const char *n, const char *m="r") { File x; std::string p=std::string("data")+n; x.f=fopen(p.c_str(), m); return x; }
+    bool remove(const char *n) { return ::remove((std::string("data")+n).c_str()) == 0; }
+};
+extern FS SPIFFS;
+#include <thread>
+static inline int xTaskCreatePinnedToCore(void (*fn)(void*), const char*, int, void *arg, int, void*, int) { std::thread(fn, arg).detach(); return 1; }
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+struct hw_timer_t { int n; };
+static void (*host_isr[64])(void*); static void *host_arg[64];
+static inline void attachInterruptArg(int pin, void (*f)(void*), void *a, int) { host_isr[pin] = f; host_arg[pin] = a; }
+static inline void detachInterrupt(int pin) { host_isr[pin] = 0; }
+static hw_timer_t host_timer; static void (*host_timer_isr)();
+static inline hw_timer_t *timerBegin(int, int, bool) { return &host_timer; }
+static inline void timerAttachInterrupt(hw_timer_t*, void (*f)(), bool) { host_timer_isr = f; }
+static inline void timerAlarmWrite(hw_timer_t*, unsigned, bool) {}
+static inline void timerAlarmEnable(hw_timer_t*) {}
+static inline void timerAlarmDisable(hw_timer_t*) {}
+#endif
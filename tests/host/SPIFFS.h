@@ -0,0 +1 @@
+#include "Arduino.h"
@@ -0,0 +1,66 @@
+/******************************************************************************/
+/* WiFi.h - host stand-in for the ESP32 WiFi library, on BSD sockets          */
+/******************************************************************************/
+/* WiFi.begin() connects at once, WiFiServer listens on 127.0.0.1 at the port */
+/* given plus 8000 (80 => 8080) or at $PORT, so a browser or curl on the host */
+/* can talk to the sketch's web console.                                      */
+/******************************************************************************/
+#pragma once
+#include "Arduino.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <memory>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#define WL_CONNECTED 3
+#define WIFI_STA     1
+struct IPAddress { operator const char*() const { return "127.0.0.1"; } };
+struct WiFiClient {
+    std::shared_ptr<int> fd;                /* closed with the last copy */
+    WiFiClient() {}
+    explicit WiFiClient(int s) : fd(new int(s), [](int *p) { if (*p >= 0) close(*p); delete p; }) {}
+    operator bool() const { return fd && *fd >= 0; }
+    bool connected() {
+        char c;
+        if (!*this) return false;
+        int n = recv(*fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+        return n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+    }
+    int available() { int n = 0; if (*this) ioctl(*fd, FIONREAD, &n); return n; }
+    int read() { unsigned char c; return *this && recv(*fd, &c, 1, 0) == 1 ? c : -1; }
+    void print(const char *s) { if (*this) send(*fd, s, strlen(s), MSG_NOSIGNAL); }
+    void println(const char *s) { print(s); print("\r\n"); }
+    void println(int v, int b) { char t[16]; snprintf(t, sizeof(t), b == 16 ? "%x" : "%d", v); println(t); }
+    void stop() { if (*this) { close(*fd); *fd = -1; } }
+};
+struct WiFiServer {
+    int s = -1;
+    void begin(int port = 80) {
+        sockaddr_in a = {};
+        int on = 1;
+        a.sin_family = AF_INET;
+        a.sin_port = htons(getenv("PORT") ? atoi(getenv("PORT")) : port + 8000);
+        a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        s = socket(AF_INET, SOCK_STREAM, 0);
+        setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        if (bind(s, (sockaddr*)&a, sizeof(a)) || listen(s, 16)) { perror("WiFiServer"); exit(1); }
+        fcntl(s, F_SETFL, O_NONBLOCK);      /* available() polls */
+    }
+    WiFiClient available() {
+        int c = accept(s, NULL, NULL), on = 1;
+        if (c < 0) return WiFiClient();
+        fcntl(c, F_SETFL, 0);
+        setsockopt(c, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        return WiFiClient(c);
+    }
+};
+struct WiFiClass {
+    void mode(int) {}
+    void begin(const char*, const char*) {}
+    int  status() { return WL_CONNECTED; }
+    IPAddress localIP() { return IPAddress(); }
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,76 @@
+/******************************************************************************/
+/* io_lat81.cpp - web console round trip of esp32forth8_1 (IO_SPLIT) on host  */
+/******************************************************************************/
+/* Runs the sketch's setup()/loop() with io_task on its own thread and fires  */
+/* HTTP POSTs of "1 2 + ." at it over loopback, from several clients at once, */
+/* then prints round-trip times. With "load" a Forth task keeps the VM busy   */
+/* between pauses. Sketch output goes to stdout, the results to stderr.       */
+/*                                                                            */
+/*   g++ -std=gnu++17 -O2 -I. -o io_lat81 io_lat81.cpp -lpthread              */
+/*   ./io_lat81 [requests] [clients] [load] > /dev/null                       */
+/******************************************************************************/
+#include "Arduino.h"
+#include "WiFi.h"
+HardwareSerial Serial; FS SPIFFS; WiFiClass WiFi;
+#include "../../orig/esp32forth8_1.ino"
+#include <chrono>
+#include <vector>
+#include <algorithm>
+using clk = std::chrono::steady_clock;
+
+static const char *POST =
+    "POST /input HTTP/1.1\r\nHost: esp32\r\n\r\n"
+    "---CMD\r\n1 2 + .\r\n---CMD\r\n";
+
+static double round_trip(std::string &reply) {     /* one request, in us */
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(getenv("PORT") ? atoi(getenv("PORT")) : 8080);
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    auto t0 = clk::now();
+    int s = socket(AF_INET, SOCK_STREAM, 0), on = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    if (connect(s, (sockaddr*)&a, sizeof(a))) { perror("connect"); exit(1); }
+    send(s, POST, strlen(POST), 0);
+    char buf[512];
+    for (int n; (n = recv(s, buf, sizeof(buf), 0)) > 0; ) reply.append(buf, n);
+    close(s);                                       /* server closes at the end */
+    return std::chrono::duration<double, std::micro>(clk::now() - t0).count();
+}
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 200;
+    int nc = argc > 2 ? atoi(argv[2]) : 1;
+    bool load = argc > 3;
+    std::atomic<bool> up{false};
+    std::thread vm_th([&] {                         /* the Arduino loop task */
+        setup();
+        if (load) {
+            vm.outer(": hog begin 9999 for next pause again ; task ' hog over activate drop",
+                     [](int, const char*) {});
+        }
+        up = true;
+        for (;;) loop();
+    });
+    while (!up) delay(1);
+    std::vector<double> us;
+    std::mutex mtx;
+    std::vector<std::thread> th;
+    int bad = 0;
+    for (int c = 0; c < nc; c++) th.emplace_back([&] {
+        for (int i = 0; i < n; i++) {
+            std::string r;
+            double t = round_trip(r);
+            std::lock_guard<std::mutex> lk(mtx);
+            us.push_back(t);
+            if (r.find("3 ") == std::string::npos) bad++;
+        }
+    });
+    for (auto &t : th) t.join();
+    std::sort(us.begin(), us.end());
+    double sum = 0;
+    for (double u : us) sum += u;
+    int k = us.size();
+    fprintf(stderr, "%d requests, %d clients%s: mean %.0f us, p50 %.0f, p99 %.0f, max %.0f, bad replies %d\n",
+            k, nc, load ? ", busy VM" : "", sum / k, us[k / 2], us[k * 99 / 100], us.back(), bad);
+    _exit(bad != 0);
+}
@@ -0,0 +1,47 @@
+/******************************************************************************/
+/* irq_lat81.cpp - deferred interrupt latency of esp32forth8_1 on host        */
+/******************************************************************************/
+/* SIGALRM stands in for a GPIO edge on pin 4: every <us> it calls the ISR    */
+/* irq installed, while the VM (and <vms>-1 more VMs on the frozen base) run  */
+/* a 3M-call loop. Prints irq-stat (worst ISR time, worst ISR to handler     */
+/* delay, drops) and checks every event was handled exactly once.             */
+/*                                                                            */
+/*   g++ -std=gnu++17 -O2 -I. -o irq_lat81 irq_lat81.cpp -lpthread            */
+/*   ./irq_lat81 [us] [vms]                                                   */
+/******************************************************************************/
+#include "Arduino.h"
+#include "WiFi.h"
+HardwareSerial Serial; FS SPIFFS; WiFiClass WiFi;
+#include "../../orig/esp32forth8_1.ino"
+#include <signal.h>
+#include <sys/time.h>
+#include <vector>
+static void out(int, const char *s) { fputs(s, stdout); }
+static volatile int fired = 0;
+static void on_alarm(int) {                         /* the "GPIO edge" */
+    if (host_isr[4]) { host_isr[4](host_arg[4]); fired++; }
+}
+int main(int argc, char **argv) {
+    int us  = argc > 1 ? atoi(argv[1]) : 200;
+    int nvm = argc > 2 ? atoi(argv[2]) : 1;
+    vm.init();
+    vm.outer(": w ; : b 2999999 for w next ;", out);
+    vm.freeze();
+    vm.outer("variable n : h ( ts v -- ) 2drop 1 n +! ; 4 1 ' h irq", out);
+    signal(SIGALRM, on_alarm);
+    itimerval tv = { { 0, us }, { 0, us } };
+    setitimer(ITIMER_REAL, &tv, NULL);
+    std::vector<std::thread> th;
+    for (int i = 1; i < nvm; i++) th.emplace_back([] { ForthVM v; v.init(); v.outer("b", out); });
+    vm.outer("clock b clock swap - .( loop ms=) .", out);
+    for (auto &t : th) t.join();
+    tv = {};
+    setitimer(ITIMER_REAL, &tv, NULL);
+    vm.outer("w irq-stat n @ 4 irq-off", out);      /* w drains what is left */
+    DU n = POP(), drop = POP(), lat = POP(), isr = POP();
+    printf("\n%d VMs, edge every %d us: %d edges, %d handled, %d dropped, "
+           "worst ISR %d us, worst ISR to handler %d us\n",
+           nvm, us, fired, (int)n, (int)drop, (int)isr, (int)lat);
+    fflush(stdout);
+    _exit(n + drop == fired ? 0 : 1);
+}
@@ -0,0 +1,45 @@
+/******************************************************************************/
+/* vm_mt81.cpp - multi-VM scaling of esp32forth8_1 on host                    */
+/******************************************************************************/
+/* Builds the base dictionary once, freezes it, then runs the same 20M-call  */
+/* loop on 1, 2, 4... VMs, one pthread each, up to the core count (or <max>)  */
+/* and below OVL_MAX, since the builder VM keeps overlay 0 after freeze.      */
+/* With perfect scaling the wall time stays flat as VMs are added.            */
+/*                                                                            */
+/*   g++ -std=gnu++17 -O2 -I. -o vm_mt81 vm_mt81.cpp -lpthread                */
+/*   ./vm_mt81 [max]                                                          */
+/******************************************************************************/
+#include "Arduino.h"
+#include "WiFi.h"
+HardwareSerial Serial; FS SPIFFS; WiFiClass WiFi;
+#include "../../orig/esp32forth8_1.ino"
+#include <chrono>
+#include <vector>
+static void quiet(int, const char *) {}
+int main(int argc, char **argv) {
+    int max = argc > 1 ? atoi(argv[1]) : (int)std::thread::hardware_concurrency();
+    vm.init();
+    vm.outer(": b1 999999 for 34 drop next ; : b2 19 for b1 next ;", quiet);
+    vm.freeze();
+    double t1 = 0;
+    for (int n = 1; n <= max && n < OVL_MAX; n *= 2) {   /* freeze took overlay 0 */
+        auto t0 = std::chrono::steady_clock::now();
+        std::vector<std::thread> th;
+        std::atomic<int> ok{0};
+        for (int i = 0; i < n; i++) th.emplace_back([i, &ok] {
+            ForthVM v;
+            char cmd[64];
+            if (!v.init()) return;
+            sprintf(cmd, ": mine %d ; b2 mine", i);  /* own word in each overlay */
+            v.outer(cmd, quiet);
+            if (top == i && ss.idx == 1) ok++;
+        });
+        for (auto &t : th) t.join();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        if (n == 1) t1 = ms;
+        printf("%d VMs: %6.0f ms, %.2fx the work of 1 VM per unit time%s\n",
+               n, ms, n * t1 / ms, ok == n ? "" : ", WRONG RESULT");
+    }
+    fflush(stdout);
+    _exit(0);
+}